@@ -0,0 +1,116 @@
+/**
+ * @file alloc_policy.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements central heap allocation policy.
+ */
+#include "alloc_policy.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+static const char *TAG = "alloc_policy";
+
+#define CAPS_INTERNAL (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define CAPS_SPIRAM (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+/**
+ * @brief Pools used by subsystem
+ */
+typedef struct {
+    const char *name;
+    uint32_t primary_caps;
+    uint32_t fallback_caps;     ///< 0 if there is no fallback
+} subsystem_policy_t;
+
+#if CONFIG_ALLOC_POLICY_BULK_SPIRAM_ONLY
+#define BULK_POLICY CAPS_SPIRAM, 0
+#elif CONFIG_ALLOC_POLICY_BULK_SPIRAM_PREFERRED
+#define BULK_POLICY CAPS_SPIRAM, CAPS_INTERNAL
+#else
+#define BULK_POLICY CAPS_INTERNAL, 0
+#endif
+
+static const subsystem_policy_t policies[ALLOC_POLICY_SUBSYSTEM_MAX] = {
+    [ALLOC_POLICY_SUBSYSTEM_SNIFFER] = { "sniffer", CAPS_INTERNAL, 0 },
+    [ALLOC_POLICY_SUBSYSTEM_PCAP] = { "pcap", BULK_POLICY },
+    [ALLOC_POLICY_SUBSYSTEM_ATTACK_STATUS] = { "attack_status", BULK_POLICY },
+    [ALLOC_POLICY_SUBSYSTEM_JSON] = { "json", BULK_POLICY },
+    [ALLOC_POLICY_SUBSYSTEM_LOG] = { "log", BULK_POLICY },
+};
+
+/**
+ * @brief Number of successful allocations per subsystem and pool
+ */
+//@{
+static atomic_uint primary_allocations[ALLOC_POLICY_SUBSYSTEM_MAX];
+static atomic_uint fallback_allocations[ALLOC_POLICY_SUBSYSTEM_MAX];
+static atomic_uint failed_allocations[ALLOC_POLICY_SUBSYSTEM_MAX];
+//@}
+
+static const char *pool_name(uint32_t caps){
+    return (caps & MALLOC_CAP_SPIRAM) ? "SPIRAM" : "internal";
+}
+
+void *alloc_policy_malloc(alloc_policy_subsystem_t subsystem, size_t size){
+    const subsystem_policy_t *policy = &policies[subsystem];
+    void *ptr = heap_caps_malloc(size, policy->primary_caps);
+    if(ptr != NULL){
+        atomic_fetch_add_explicit(&primary_allocations[subsystem], 1, memory_order_relaxed);
+        return ptr;
+    }
+    if(policy->fallback_caps != 0){
+        ptr = heap_caps_malloc(size, policy->fallback_caps);
+        if(ptr != NULL){
+            atomic_fetch_add_explicit(&fallback_allocations[subsystem], 1, memory_order_relaxed);
+            return ptr;
+        }
+    }
+    atomic_fetch_add_explicit(&failed_allocations[subsystem], 1, memory_order_relaxed);
+    return NULL;
+}
+
+void *alloc_policy_realloc(alloc_policy_subsystem_t subsystem, void *ptr, size_t size){
+    if(ptr == NULL){
+        return alloc_policy_malloc(subsystem, size);
+    }
+    const subsystem_policy_t *policy = &policies[subsystem];
+    void *reallocated = heap_caps_realloc(ptr, size, policy->primary_caps);
+    if(reallocated != NULL){
+        atomic_fetch_add_explicit(&primary_allocations[subsystem], 1, memory_order_relaxed);
+        return reallocated;
+    }
+    if(policy->fallback_caps != 0){
+        reallocated = heap_caps_realloc(ptr, size, policy->fallback_caps);
+        if(reallocated != NULL){
+            atomic_fetch_add_explicit(&fallback_allocations[subsystem], 1, memory_order_relaxed);
+            return reallocated;
+        }
+    }
+    atomic_fetch_add_explicit(&failed_allocations[subsystem], 1, memory_order_relaxed);
+    return NULL;
+}
+
+void alloc_policy_report(){
+    ESP_LOGI(TAG, "Free heap: internal %u B (minimum %u B), SPIRAM %u B",
+        (unsigned) heap_caps_get_free_size(CAPS_INTERNAL),
+        (unsigned) heap_caps_get_minimum_free_size(CAPS_INTERNAL),
+        (unsigned) heap_caps_get_free_size(CAPS_SPIRAM));
+    for(unsigned i = 0; i < ALLOC_POLICY_SUBSYSTEM_MAX; i++){
+        const subsystem_policy_t *policy = &policies[i];
+        ESP_LOGI(TAG, "%-14s -> %s%s%s (allocations: %u primary, %u fallback, %u failed)",
+            policy->name,
+            pool_name(policy->primary_caps),
+            policy->fallback_caps ? ", fallback " : "",
+            policy->fallback_caps ? pool_name(policy->fallback_caps) : "",
+            atomic_load(&primary_allocations[i]),
+            atomic_load(&fallback_allocations[i]),
+            atomic_load(&failed_allocations[i]));
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file alloc_policy.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Provides central heap allocation policy for subsystems.
+ * 
+ * Every subsystem allocates through this component, which decides in which memory pool the allocation ends up.
+ * Bulk data (captures, status content, JSON output) can be placed into external SPIRAM, while
+ * hot structures used by capture path stay in internal RAM. Policy is chosen in menuconfig.
+ */
+#ifndef ALLOC_POLICY_H
+#define ALLOC_POLICY_H
+
+#include <stddef.h>
+
+/**
+ * @brief Subsystems that allocate memory through allocation policy.
+ */
+typedef enum {
+    ALLOC_POLICY_SUBSYSTEM_SNIFFER,         ///< frame ring, hot - always internal RAM
+    ALLOC_POLICY_SUBSYSTEM_PCAP,            ///< PCAP storage, bulk
+    ALLOC_POLICY_SUBSYSTEM_ATTACK_STATUS,   ///< attack status content, bulk
+    ALLOC_POLICY_SUBSYSTEM_JSON,            ///< cJSON documents and output, bulk
+    ALLOC_POLICY_SUBSYSTEM_LOG,             ///< log ring, bulk
+    ALLOC_POLICY_SUBSYSTEM_MAX
+} alloc_policy_subsystem_t;
+
+/**
+ * @brief Allocates memory for given subsystem in pool chosen by policy.
+ * 
+ * Memory is freed by standard free().
+ * 
+ * @param subsystem 
+ * @param size 
+ * @return void* pointer to allocated memory
+ * @return \c NULL if allocation failed
+ */
+void *alloc_policy_malloc(alloc_policy_subsystem_t subsystem, size_t size);
+
+/**
+ * @brief Reallocates memory previously allocated by alloc_policy_malloc() for the same subsystem.
+ * 
+ * @param subsystem 
+ * @param ptr 
+ * @param size 
+ * @return void* pointer to reallocated memory
+ * @return \c NULL if reallocation failed, original memory is kept
+ */
+void *alloc_policy_realloc(alloc_policy_subsystem_t subsystem, void *ptr, size_t size);
+
+/**
+ * @brief Prints report of memory pools used by each subsystem and free sizes of pools to log.
+ */
+void alloc_policy_report();
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ * @file capture_clock.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements capture clock.
+ * 
+ * Offset of radio timestamp to lower 32 bits of esp_timer is learned from the first frame. Age of every frame 
+ * is then difference of expected current radio time and its radio timestamp modulo 2^32, which doesn't depend
+ * on wrapping of radio timestamp. Timestamp of the frame is current esp_timer time minus its age.
+ */
+#include "capture_clock.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_timer.h"
+
+static atomic_bool synchronised = false;
+static atomic_uint radio_offset = 0;
+static int64_t realtime_offset = 0;
+static bool realtime = false;
+
+void capture_clock_reset(){
+    atomic_store(&synchronised, false);
+}
+
+void capture_clock_set_realtime(uint64_t unix_usec){
+    realtime_offset = (int64_t) unix_usec - esp_timer_get_time();
+    realtime = true;
+}
+
+bool capture_clock_is_realtime(){
+    return realtime;
+}
+
+uint64_t capture_clock_get_timestamp(uint32_t radio_timestamp){
+    int64_t now = esp_timer_get_time();
+    if(!atomic_exchange(&synchronised, true)){
+        atomic_store(&radio_offset, radio_timestamp - (uint32_t) now);
+    }
+    uint32_t offset = atomic_load(&radio_offset);
+    int32_t age = (int32_t) ((uint32_t) now + offset - radio_timestamp);
+    if(age < 0){
+        // radio clock runs ahead of esp_timer, adjust offset so frames are never from the future
+        atomic_store(&radio_offset, offset - age);
+        age = 0;
+    }
+    return now - age + realtime_offset;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file capture_clock.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Provides monotonic 64-bit timestamps of captured frames.
+ * 
+ * Radio timestamp in wifi_pkt_rx_ctrl_t is 32-bit microsecond counter that wraps after ~71 minutes.
+ * Capture clock extends it to 64 bits by relating it to 64-bit esp_timer. Resulting timestamps are 
+ * microseconds since boot, or since Unix epoch once the clock is anchored to real time by capture_clock_set_realtime().
+ */
+#ifndef CAPTURE_CLOCK_H
+#define CAPTURE_CLOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Forgets learned relation of radio timestamps to esp_timer. Real time anchor is kept.
+ * 
+ * Should be called when new capture starts, e.g. after radio was stopped.
+ */
+void capture_clock_reset();
+
+/**
+ * @brief Anchors capture clock to real time.
+ * 
+ * @param unix_usec current real time in microseconds since Unix epoch
+ */
+void capture_clock_set_realtime(uint64_t unix_usec);
+
+/**
+ * @brief Says whether capture clock was anchored to real time.
+ * 
+ * @return true timestamps are microseconds since Unix epoch
+ * @return false timestamps are microseconds since boot
+ */
+bool capture_clock_is_realtime();
+
+/**
+ * @brief Returns 64-bit timestamp of the frame received at given radio timestamp.
+ * 
+ * Frames have to be processed within ~35 minutes after reception. Timestamps don't go backwards 
+ * for frames processed in order of reception.
+ * 
+ * @param radio_timestamp rx_ctrl.timestamp of received frame
+ * @return uint64_t timestamp in microseconds
+ */
+uint64_t capture_clock_get_timestamp(uint32_t radio_timestamp);
+
+#endif
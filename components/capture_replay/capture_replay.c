@@ -0,0 +1,213 @@
+/**
+ * @file capture_replay.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements replay of recorded PCAP files through capture pipeline.
+ */
+#include "capture_replay.h"
+
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "esp_wifi_types.h"
+
+#include "wifi_controller.h"
+#include "pcap_serializer.h"
+
+static const char *TAG = "capture_replay";
+
+/**
+ * @brief PCAP magic numbers of captures with microsecond and nanosecond timestamps
+ * @{
+ */
+#define PCAP_MAGIC_NUMBER_USEC 0xa1b2c3d4
+#define PCAP_MAGIC_NUMBER_NSEC 0xa1b23c4d
+//@}
+
+/**
+ * @brief Supported link types
+ *
+ * @see Ref: http://www.tcpdump.org/linktypes.html
+ * @{
+ */
+#define LINKTYPE_IEEE802_11 105
+#define LINKTYPE_IEEE802_11_RADIOTAP 127
+//@}
+
+/**
+ * @brief Longest sleep of realtime replay before stop request is checked again
+ */
+#define STOP_CHECK_INTERVAL_USEC 10000
+
+/**
+ * @brief Radiotap header fields needed to skip it
+ */
+typedef struct {
+    uint8_t version;
+    uint8_t pad;
+    uint16_t length;
+} radiotap_header_t;
+
+/**
+ * @brief Replayed frame, word aligned like frames delivered by Wi-Fi driver
+ */
+static union {
+    wifi_promiscuous_pkt_t packet;
+    uint32_t words[(sizeof(wifi_promiscuous_pkt_t) + CONFIG_SNIFFER_MAX_FRAME_SIZE + 3) / 4];
+} frame;
+
+static atomic_bool stop_requested = false;
+
+/**
+ * @brief Returns promiscuous packet type from type field of 802.11 frame control.
+ *
+ * @param payload
+ * @param type
+ * @return false if frame is not data, management or control frame
+ */
+static bool get_packet_type(const uint8_t *payload, wifi_promiscuous_pkt_type_t *type){
+    switch((payload[0] >> 2) & 0x03){
+        case 0:
+            *type = WIFI_PKT_MGMT;
+            return true;
+        case 1:
+            *type = WIFI_PKT_CTRL;
+            return true;
+        case 2:
+            *type = WIFI_PKT_DATA;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Sleeps until given time since replay start, unless replay is stopped meanwhile.
+ * 
+ * @param start start of replay
+ * @param usec time since start
+ */
+static void sleep_until(int64_t start, int64_t usec){
+    int64_t delay;
+    while(((delay = usec - (esp_timer_get_time() - start)) > 0) && !atomic_load(&stop_requested)){
+        usleep((delay > STOP_CHECK_INTERVAL_USEC) ? STOP_CHECK_INTERVAL_USEC : delay);
+    }
+}
+
+esp_err_t capture_replay_run(capture_replay_read_t read, void *ctx, size_t size, const capture_replay_config_t *config, capture_replay_stats_t *stats){
+    memset(stats, 0, sizeof(capture_replay_stats_t));
+
+    pcap_global_header_t global_header;
+    if(size < sizeof(global_header)){
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    esp_err_t err = read(ctx, 0, &global_header, sizeof(global_header));
+    if(err != ESP_OK){
+        return err;
+    }
+    if(((global_header.magic_number != PCAP_MAGIC_NUMBER_USEC) && (global_header.magic_number != PCAP_MAGIC_NUMBER_NSEC))
+        || ((global_header.network != LINKTYPE_IEEE802_11) && (global_header.network != LINKTYPE_IEEE802_11_RADIOTAP))){
+        ESP_LOGE(TAG, "Unsupported capture (magic %08x, link type %u)", (unsigned) global_header.magic_number, (unsigned) global_header.network);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    const unsigned fraction_divider = (global_header.magic_number == PCAP_MAGIC_NUMBER_NSEC) ? 1000 : 1;
+
+    int64_t start = esp_timer_get_time();
+    uint64_t first_ts_usec = 0;
+    uint64_t ts_usec = 0;
+    size_t offset = sizeof(global_header);
+    pcap_record_header_t record_header;
+    while((offset + sizeof(record_header) <= size) && !atomic_load(&stop_requested)){
+        if((err = read(ctx, offset, &record_header, sizeof(record_header))) != ESP_OK){
+            return err;
+        }
+        offset += sizeof(record_header);
+        if((record_header.incl_len > size - offset) || (record_header.incl_len > global_header.snaplen)){
+            // the rest is not a record, e.g. erased flash behind capture
+            break;
+        }
+        size_t data_offset = offset;
+        unsigned length = record_header.incl_len;
+        offset += record_header.incl_len;
+
+        if(global_header.network == LINKTYPE_IEEE802_11_RADIOTAP){
+            radiotap_header_t radiotap_header;
+            if((length < sizeof(radiotap_header))
+                || ((err = read(ctx, data_offset, &radiotap_header, sizeof(radiotap_header))) != ESP_OK)
+                || (radiotap_header.length > length)){
+                stats->skipped++;
+                continue;
+            }
+            data_offset += radiotap_header.length;
+            length -= radiotap_header.length;
+        }
+        if((length == 0) || (length > CONFIG_SNIFFER_MAX_FRAME_SIZE)){
+            stats->skipped++;
+            continue;
+        }
+        if((err = read(ctx, data_offset, frame.packet.payload, length)) != ESP_OK){
+            return err;
+        }
+        wifi_promiscuous_pkt_type_t type;
+        if(!get_packet_type(frame.packet.payload, &type)){
+            stats->skipped++;
+            continue;
+        }
+
+        ts_usec = (uint64_t) record_header.ts_sec * 1000000 + record_header.ts_usec / fraction_divider;
+        if(stats->frames == 0){
+            first_ts_usec = ts_usec;
+        }
+        if(config->realtime){
+            sleep_until(start, (int64_t) (ts_usec - first_ts_usec));
+            if(atomic_load(&stop_requested)){
+                break;
+            }
+        }
+        memset(&frame.packet.rx_ctrl, 0, sizeof(wifi_pkt_rx_ctrl_t));
+        frame.packet.rx_ctrl.sig_len = length;
+        frame.packet.rx_ctrl.channel = config->channel;
+        // radio timestamp is time since capture started, capture clock extends it as for captured frames
+        frame.packet.rx_ctrl.timestamp = (uint32_t) (ts_usec - first_ts_usec);
+        wifictl_sniffer_inject(&frame.packet, type);
+        stats->frames++;
+    }
+    stats->capture_usec = ts_usec - first_ts_usec;
+    stats->elapsed_usec = esp_timer_get_time() - start;
+    ESP_LOGI(TAG, "Replayed %u frames (%u skipped) in %u ms", stats->frames, stats->skipped, (unsigned) (stats->elapsed_usec / 1000));
+    return ESP_OK;
+}
+
+/**
+ * @brief Reads capture from partition
+ *
+ * @param ctx esp_partition_t
+ */
+static esp_err_t partition_read(void *ctx, size_t offset, void *data, size_t length){
+    return esp_partition_read((const esp_partition_t *) ctx, offset, data, length);
+}
+
+esp_err_t capture_replay_partition(const char *label, const capture_replay_config_t *config, capture_replay_stats_t *stats){
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if(partition == NULL){
+        ESP_LOGE(TAG, "No partition '%s' with capture to replay", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    ESP_LOGI(TAG, "Replaying capture from partition '%s'", label);
+    return capture_replay_run(&partition_read, (void *) partition, partition->size, config, stats);
+}
+
+void capture_replay_reset(){
+    atomic_store(&stop_requested, false);
+}
+
+void capture_replay_stop(){
+    atomic_store(&stop_requested, true);
+}
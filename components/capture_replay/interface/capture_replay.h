@@ -0,0 +1,94 @@
+/**
+ * @file capture_replay.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides replay of recorded PCAP files through capture pipeline.
+ *
+ * Every frame of the capture is passed to wifictl_sniffer_inject(), the same entry point promiscuous callback uses,
+ * so it goes through sniffer filters, frame ring, frame analyzer and serializers like frame received by radio.
+ * Replay either honours capture timestamps or runs as fast as possible.
+ */
+#ifndef CAPTURE_REPLAY_H
+#define CAPTURE_REPLAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+/**
+ * @brief Callback reading part of replayed capture.
+ *
+ * @param ctx user context given to capture_replay_run()
+ * @param offset offset in capture
+ * @param data output buffer
+ * @param length number of bytes to read
+ * @return esp_err_t replay stops on first error
+ */
+typedef esp_err_t (*capture_replay_read_t)(void *ctx, size_t offset, void *data, size_t length);
+
+/**
+ * @brief Replay settings
+ */
+typedef struct {
+    bool realtime;          ///< keep time gaps between frames as recorded, otherwise replay as fast as possible
+    uint8_t channel;        ///< channel reported in rx_ctrl of replayed frames
+} capture_replay_config_t;
+
+/**
+ * @brief Replay results
+ */
+typedef struct {
+    unsigned frames;            ///< frames injected into sniffer
+    unsigned skipped;           ///< records not injected - too big for sniffer or not data, management or control frame
+    uint64_t capture_usec;      ///< time between the first and the last frame of capture
+    uint64_t elapsed_usec;      ///< time replay took
+} capture_replay_stats_t;
+
+/**
+ * @brief Replays classic PCAP capture (LINKTYPE_IEEE802_11 or LINKTYPE_IEEE802_11_RADIOTAP) through sniffer.
+ *
+ * Capture is read by parts, so it doesn't have to fit into memory. Radiotap headers are stripped.
+ * Replay ends at the end of capture, at the first record that doesn't fit into it (e.g. erased flash
+ * after capture written into partition) or when capture_replay_stop() is called.
+ * Stop request is not cleared by this function, see capture_replay_reset().
+ *
+ * @param read reads capture
+ * @param ctx passed to read
+ * @param size size of capture in bytes
+ * @param config
+ * @param stats replay results
+ * @return esp_err_t
+ * @return ESP_ERR_NOT_SUPPORTED if capture is not classic PCAP with supported link type
+ */
+esp_err_t capture_replay_run(capture_replay_read_t read, void *ctx, size_t size, const capture_replay_config_t *config, capture_replay_stats_t *stats);
+
+/**
+ * @brief Replays PCAP capture stored at the beginning of data partition with given label.
+ *
+ * @param label partition label
+ * @param config
+ * @param stats replay results
+ * @return esp_err_t
+ * @return ESP_ERR_NOT_FOUND if there is no such partition
+ */
+esp_err_t capture_replay_partition(const char *label, const capture_replay_config_t *config, capture_replay_stats_t *stats);
+
+/**
+ * @brief Clears stop request of previous replay.
+ *
+ * Has to be called before replay is started again after capture_replay_stop(). If replay runs in its own task, 
+ * call it before the task is created, so capture_replay_stop() called before the task runs isn't lost.
+ */
+void capture_replay_reset();
+
+/**
+ * @brief Stops running replay after the frame being replayed. Realtime replay is stopped also while waiting for next frame.
+ *
+ * Request stays until capture_replay_reset(), so replay started after this call ends immediately.
+ */
+void capture_replay_stop();
+
+#endif
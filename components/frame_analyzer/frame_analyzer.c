@@ -8,74 +8,167 @@
  */
 #include "frame_analyzer.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#define LOG_LOCAL_LEVEL CONFIG_FRAME_ANALYZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
 
 #include "wifi_controller.h"
 #include "frame_analyzer_parser.h"
+#include "frame_analyzer_types.h"
+#include "metrics.h"
 
 static const char *TAG = "frame_analyzer";
-static uint8_t target_bssid[6];
-static search_type_t search_type = -1;
 
+ESP_EVENT_DEFINE_BASE(FRAME_ANALYZER_EVENTS);
 
+static search_type_t search_type = -1;
+static sniffer_subscription_t subscription;
+static frame_analyzer_eapolkey_cb_t eapolkey_callback = NULL;
 /**
- * @brief Analyzes data frames from sniffer.
- *  
- * @param args 
- * @param event_base 
+ * @brief EAPOL-Key frames of current sniffer batch, borrowed from sniffer until the batch ends
+ */
+static const wifi_promiscuous_pkt_t *eapolkey_frames[CONFIG_SNIFFER_BATCH_SIZE];
+static unsigned eapolkey_frame_count = 0;
+
+/**
+ * @brief Posts event to event loop and counts it.
+ * 
+ * Event is posted without waiting first, so posts that have to wait for free space in event queue are counted.
+ * 
  * @param event_id 
  * @param event_data 
+ * @param event_data_size 
+ * @return esp_err_t 
  */
-static void data_frame_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGV(TAG, "Handling DATA frame");
-    wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
-
-    if(!is_frame_bssid_matching(frame, target_bssid)){
-        ESP_LOGV(TAG, "Not matching BSSIDs.");
-        return;
+static esp_err_t post_event(int32_t event_id, const void *event_data, size_t event_data_size){
+    esp_err_t err = esp_event_post(FRAME_ANALYZER_EVENTS, event_id, event_data, event_data_size, 0);
+    if(err == ESP_ERR_TIMEOUT){
+        metrics_counter_inc(METRICS_FRAME_ANALYZER_EVENTS_BLOCKED);
+        err = esp_event_post(FRAME_ANALYZER_EVENTS, event_id, event_data, event_data_size, portMAX_DELAY);
     }
+    metrics_counter_inc(err == ESP_OK ? METRICS_FRAME_ANALYZER_EVENTS_POSTED : METRICS_FRAME_ANALYZER_EVENTS_FAILED);
+    return err;
+}
+
+/**
+ * @brief Counts frame analyzer events taken from event queue.
+ * 
+ * It's registered on first capture start, before any other handler of FRAME_ANALYZER_EVENTS, so it runs first for every event.
+ */
+static void event_counter_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data){
+    metrics_counter_inc(METRICS_FRAME_ANALYZER_EVENTS_HANDLED);
+}
+
+/**
+ * @brief Gauge of frame analyzer events waiting in event queue
+ */
+static unsigned get_pending_events(){
+    return metrics_counter_get(METRICS_FRAME_ANALYZER_EVENTS_POSTED) - metrics_counter_get(METRICS_FRAME_ANALYZER_EVENTS_HANDLED);
+}
 
-    eapol_packet_t *eapol_packet = parse_eapol_packet((data_frame_t *) frame->payload);
+/**
+ * @brief Analyzes data frame and posts results to event pool.
+ * 
+ * @param frame 
+ */
+static void analyze_data_frame(const wifi_promiscuous_pkt_t *frame) {
+    ESP_LOGV(TAG, "Handling DATA frame");
+    metrics_counter_inc(METRICS_FRAME_ANALYZER_FRAMES);
+
+    unsigned eapol_length;
+    const eapol_packet_t *eapol_packet = parse_eapol_packet((const data_frame_t *) frame->payload, frame->rx_ctrl.sig_len, &eapol_length);
     if(eapol_packet == NULL){
         ESP_LOGV(TAG, "Not an EAPOL packet.");
         return;
     }
+    metrics_counter_inc(METRICS_FRAME_ANALYZER_EAPOL);
 
-    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
-    if(eapol_key_packet == NULL){
+    eapol_key_view_t eapol_key;
+    if(!parse_eapol_key_packet(eapol_packet, eapol_length, &eapol_key)){
         ESP_LOGV(TAG, "Not an EAPOL-Key packet");
         return;
     }
+    metrics_counter_inc(METRICS_FRAME_ANALYZER_EAPOLKEY);
 
     if(search_type == SEARCH_HANDSHAKE){
+        if(eapolkey_callback != NULL){
+            // passed to callback at the end of sniffer batch
+            eapolkey_frames[eapolkey_frame_count++] = frame;
+            return;
+        }
         // TODO handle timeouts properly by e.g. for cycle
-        ESP_ERROR_CHECK_WITHOUT_ABORT(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, frame, sizeof(wifi_promiscuous_pkt_t) + frame->rx_ctrl.sig_len, portMAX_DELAY));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(post_event(DATA_FRAME_EVENT_EAPOLKEY_FRAME, frame, sizeof(wifi_promiscuous_pkt_t) + frame->rx_ctrl.sig_len));
         return;
     }
 
     if(search_type == SEARCH_PMKID){
-        pmkid_item_t *pmkid_items;
-        if((pmkid_items = parse_pmkid(eapol_key_packet)) == NULL){
+        pmkid_result_t pmkid_result;
+        if(!parse_pmkid(&eapol_key, &pmkid_result)){
             return;
         }
-        ESP_ERROR_CHECK(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_items, sizeof(pmkid_item_t *), portMAX_DELAY));
+        metrics_counter_inc(METRICS_FRAME_ANALYZER_PMKID);
+        // result is copied into event, so nothing is lost if posting fails
+        ESP_ERROR_CHECK_WITHOUT_ABORT(post_event(DATA_FRAME_EVENT_PMKID, &pmkid_result, sizeof(pmkid_result_t)));
+        return;
+    }
+}
+
+/**
+ * @brief Analyzes data frames from sniffer and measures time spent on them.
+ * 
+ * Sniffer passes only unprotected EAPOL data frames from target BSSID to this callback.
+ *  
+ * @param frame borrowed from sniffer
+ * @param type 
+ * @param args 
+ */
+static void data_frame_handler(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type, void *args) {
+    uint32_t start = metrics_histogram_start();
+    analyze_data_frame(frame);
+    metrics_histogram_observe(METRICS_HISTOGRAM_FRAME_ANALYZER_DATA_FRAME_HANDLER, start);
+}
+
+/**
+ * @brief Passes EAPOL-Key frames collected during sniffer batch to the callback.
+ * 
+ * @param args not used
+ */
+static void batch_end_handler(void *args){
+    if(eapolkey_frame_count == 0){
         return;
     }
+    eapolkey_callback(eapolkey_frames, eapolkey_frame_count);
+    eapolkey_frame_count = 0;
 }
 
-void frame_analyzer_capture_start(search_type_t search_type_arg, const uint8_t *bssid){
+void frame_analyzer_capture_start(search_type_t search_type_arg, const uint8_t *bssid, frame_analyzer_eapolkey_cb_t eapolkey_callback_arg){
     ESP_LOGI(TAG, "Frame analysis started...");
+    static bool metrics_registered = false;
+    if(!metrics_registered){
+        // Counter handler stays registered, so events still in queue after capture stops are counted as well
+        ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, ESP_EVENT_ANY_ID, &event_counter_handler, NULL));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(metrics_register_gauge("frame_analyzer_events_pending", "Frame analyzer events waiting in event queue", &get_pending_events));
+        metrics_registered = true;
+    }
     search_type = search_type_arg;
-    memcpy(&target_bssid, bssid, 6);
-    ESP_ERROR_CHECK(esp_event_handler_register(SNIFFER_EVENTS, SNIFFER_EVENT_CAPTURED_DATA, &data_frame_handler, NULL));
+    eapolkey_callback = eapolkey_callback_arg;
+    eapolkey_frame_count = 0;
+    sniffer_match_t match = { 
+        .flags = SNIFFER_MATCH_TYPE | SNIFFER_MATCH_BSSID | SNIFFER_MATCH_ETHERTYPE,
+        .type = WIFI_PKT_DATA,
+        .ethertype = ETHER_TYPE_EAPOL
+    };
+    memcpy(match.bssid, bssid, 6);
+    ESP_ERROR_CHECK(wifictl_sniffer_subscribe(&match, &data_frame_handler, &batch_end_handler, NULL, &subscription));
 }
 
 void frame_analyzer_capture_stop(){
-    ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &data_frame_handler));
+    // sniffer task doesn't call data_frame_handler after unsubscribe returns
+    wifictl_sniffer_unsubscribe(subscription);
+    eapolkey_callback = NULL;
 }
@@ -8,12 +8,12 @@
  */
 #include "frame_analyzer_parser.h"
 
-#include <stdlib.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 #include "arpa/inet.h"
 
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#define LOG_LOCAL_LEVEL CONFIG_FRAME_ANALYZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_wifi_types.h"
 
@@ -21,8 +21,6 @@
 
 static const char *TAG = "frame_analyzer:parser";
 
-ESP_EVENT_DEFINE_BASE(FRAME_ANALYZER_EVENTS);
-
 /**
  * @brief Debug function to print raw frame to serial
  * 
@@ -46,76 +44,133 @@ void print_mac_address(const uint8_t *a){
     printf("\n");
 }
 
-bool is_frame_bssid_matching(wifi_promiscuous_pkt_t *frame, uint8_t *bssid) {
-    data_frame_mac_header_t *mac_header = (data_frame_mac_header_t *) frame->payload;
+bool is_frame_bssid_matching(const wifi_promiscuous_pkt_t *frame, const uint8_t *bssid) {
+    if(frame->rx_ctrl.sig_len < sizeof(data_frame_mac_header_t)){
+        return false;
+    }
+    const data_frame_mac_header_t *mac_header = (const data_frame_mac_header_t *) frame->payload;
     return memcmp(mac_header->addr3, bssid, 6) == 0;
 }
 
-eapol_packet_t *parse_eapol_packet(data_frame_t *frame) {
-    uint8_t *frame_buffer = frame->body;
-
-    if(frame->mac_header.frame_control.protected_frame == 1) {
+const eapol_packet_t *parse_eapol_packet(const data_frame_t *frame, unsigned length, unsigned *eapol_length) {
+    if(length < sizeof(data_frame_mac_header_t)){
+        ESP_LOGV(TAG, "Frame too short (%u B)", length);
+        return NULL;
+    }
+    const frame_control_t *frame_control = &frame->mac_header.frame_control;
+    if(frame_control->protected_frame == 1) {
         ESP_LOGV(TAG, "Protected frame, skipping...");
         return NULL;
     }
 
-    if(frame->mac_header.frame_control.subtype > 7) {
+    unsigned offset = sizeof(data_frame_mac_header_t);
+    if(frame_control->to_ds && frame_control->from_ds){
+        ESP_LOGV(TAG, "4-address data frame");
+        // Skipping addr4 (6 bytes)
+        offset += 6;
+    }
+    if(frame_control->subtype > 7) {
         ESP_LOGV(TAG, "QoS data frame");
-        // Skipping QoS field (2 bytes)
-        frame_buffer += 2;
+        // Skipping QoS field (2 bytes) and HT Control field (4 bytes) if present
+        offset += frame_control->htc_order ? 6 : 2;
     }
-
     // Skipping LLC SNAP header (6 bytes)
-    frame_buffer += sizeof(llc_snap_header_t);
+    offset += sizeof(llc_snap_header_t);
 
+    // Ethertype and EAPoL header have to be within frame
+    if(length < offset + 2 + sizeof(eapol_packet_header_t)){
+        ESP_LOGV(TAG, "Frame too short for EAPoL (%u B)", length);
+        return NULL;
+    }
+    const uint8_t *frame_buffer = (const uint8_t *) frame;
     // Check if frame is type of EAPoL
-    if(ntohs(*(uint16_t *) frame_buffer) == ETHER_TYPE_EAPOL) {
-        ESP_LOGD(TAG, "EAPOL packet");
-        frame_buffer += 2;
-        return (eapol_packet_t *) frame_buffer; 
+    if(((frame_buffer[offset] << 8) | frame_buffer[offset + 1]) != ETHER_TYPE_EAPOL) {
+        return NULL;
+    }
+    offset += 2;
+
+    ESP_LOGD(TAG, "EAPOL packet");
+    const eapol_packet_t *eapol_packet = (const eapol_packet_t *) &frame_buffer[offset];
+    unsigned packet_length = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
+    if(packet_length > length - offset){
+        ESP_LOGD(TAG, "EAPoL packet truncated (%u/%u B)", length - offset, packet_length);
+        return NULL;
     }
-    return NULL;
+    *eapol_length = packet_length;
+    return eapol_packet;
 }
 
-eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet){
+bool parse_eapol_key_packet(const eapol_packet_t *eapol_packet, unsigned eapol_length, eapol_key_view_t *view){
     if(eapol_packet->header.packet_type != EAPOL_KEY){
         ESP_LOGD(TAG, "Not an EAPoL-Key packet.");
-        return NULL;
+        return false;
+    }
+    unsigned body_length = eapol_length - sizeof(eapol_packet_header_t);
+    if(body_length < sizeof(eapol_key_packet_t)){
+        ESP_LOGD(TAG, "EAPoL-Key packet truncated (%u B)", body_length);
+        return false;
+    }
+    const eapol_key_packet_t *eapol_key = (const eapol_key_packet_t *) eapol_packet->packet_body;
+    unsigned key_data_length = ntohs(eapol_key->key_data_length);
+    if(key_data_length > body_length - sizeof(eapol_key_packet_t)){
+        ESP_LOGD(TAG, "Key Data truncated (%u/%u B)", body_length - (unsigned) sizeof(eapol_key_packet_t), key_data_length);
+        return false;
     }
-    return (eapol_key_packet_t *) eapol_packet->packet_body;
+    view->eapol_packet = eapol_packet;
+    view->eapol_length = eapol_length;
+    view->eapol_key = eapol_key;
+    view->key_data = eapol_key->key_data;
+    view->key_data_length = key_data_length;
+    return true;
+}
+
+bool parse_eapol_key_frame(const data_frame_t *frame, unsigned length, eapol_key_view_t *view){
+    unsigned eapol_length;
+    const eapol_packet_t *eapol_packet = parse_eapol_packet(frame, length, &eapol_length);
+    if(eapol_packet == NULL){
+        return false;
+    }
+    return parse_eapol_key_packet(eapol_packet, eapol_length, view);
 }
 
 /**
- * @brief Parses all PMKIDs to linked list structure 
+ * @brief Parses all PMKIDs into result
  * 
  * It crawlers through key data buffer and looks for PMKIDs.
- * If PMKID element is found, its saved into the list of PMKIDs.
+ * If PMKID element is found, its saved into the result.
+ * Every element is advanced by its own length, so elements of other types are skipped and truncated element ends parsing.
  * @param key_data 
  * @param length of key data
- * @return pmkid_item_t* 
+ * @param result 
  */
-static pmkid_item_t *parse_pmkid_from_key_data(uint8_t *key_data, const uint16_t length){
-    uint8_t *key_data_index = key_data;
-    uint8_t *key_data_max_index = key_data + length;
-
-    pmkid_item_t *pmkid_item_head = NULL;
-    key_data_field_t *key_data_field;
-    do{
-        key_data_field = (key_data_field_t *) key_data_index;
-
-        ESP_LOGV(TAG, "EAPOL-Key -> Key-Data -> type=%x; length=%x; oui=%x; data_type=%x",
-                    key_data_field->type, 
-                    key_data_field->length, 
-                    key_data_field->oui,
-                    key_data_field->data_type);
-        
+static void parse_pmkid_from_key_data(const uint8_t *key_data, const unsigned length, pmkid_result_t *result){
+    unsigned offset = 0;
+    // Type and length of element have to be within key data
+    while(length - offset >= 2){
+        const key_data_field_t *key_data_field = (const key_data_field_t *) &key_data[offset];
+        unsigned field_size = 2 + key_data_field->length;
+        if(field_size > length - offset){
+            ESP_LOGD(TAG, "Key Data element truncated (%u/%u B)", length - offset, field_size);
+            break;
+        }
+        offset += field_size;
+
+        ESP_LOGV(TAG, "EAPOL-Key -> Key-Data -> type=%x; length=%x", key_data_field->type, key_data_field->length);
+
         if(key_data_field->type != KEY_DATA_TYPE){
             ESP_LOGD(TAG, "Wrong type %x (expected %x)", key_data_field->type, KEY_DATA_TYPE);
             continue;
         }
 
-        if(ntohl(key_data_field->oui) != KEY_DATA_OUI_IEEE80211){
-            ESP_LOGD(TAG, "Wrong OUI %x (expected %x)", key_data_field->oui, KEY_DATA_OUI_IEEE80211);
+        // OUI, data type and PMKID
+        if(key_data_field->length < 4 + 16){
+            ESP_LOGD(TAG, "Element too short for PMKID (%u B)", key_data_field->length);
+            continue;
+        }
+
+        unsigned oui = (key_data_field->oui[0] << 16) | (key_data_field->oui[1] << 8) | key_data_field->oui[2];
+        if(oui != KEY_DATA_OUI_IEEE80211){
+            ESP_LOGD(TAG, "Wrong OUI %x (expected %x)", oui, KEY_DATA_OUI_IEEE80211);
             continue;
         }
 
@@ -124,31 +179,35 @@ static pmkid_item_t *parse_pmkid_from_key_data(uint8_t *key_data, const uint16_t
             continue;
         }
 
-        ESP_LOGI(TAG, "Found PMKID: ");
-        pmkid_item_t *pmkid_item = (pmkid_item_t *) malloc(sizeof(pmkid_item_t));
-        pmkid_item->next = pmkid_item_head;
-        pmkid_item_head = pmkid_item;
-        for(unsigned i = 0; i < 16; i++){
-            pmkid_item->pmkid[i] = key_data_field->data[i];
-            printf("%02x", pmkid_item->pmkid[i]);
+        if(result->count == PMKID_RESULT_MAX_COUNT){
+            ESP_LOGW(TAG, "More than %u PMKIDs, ignoring the rest", PMKID_RESULT_MAX_COUNT);
+            break;
         }
-        printf("\n");
-
-    } while((key_data_index = key_data_field->data + key_data_field->length - 4 + 1) < key_data_max_index); 
-
-    return pmkid_item_head;
+        uint8_t *pmkid = result->pmkid[result->count++];
+        memcpy(pmkid, key_data_field->data, 16);
+        // Formatted only if message survives compile time level, single log call instead of printf per byte
+        if(LOG_LOCAL_LEVEL >= ESP_LOG_INFO){
+            char pmkid_hex[2 * 16 + 1];
+            for(unsigned i = 0; i < 16; i++){
+                snprintf(&pmkid_hex[2 * i], 3, "%02x", pmkid[i]);
+            }
+            ESP_LOGI(TAG, "Found PMKID: %s", pmkid_hex);
+        }
+    }
 }
 
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key){
-    if(eapol_key->key_data_length == 0){
+bool parse_pmkid(const eapol_key_view_t *view, pmkid_result_t *result){
+    result->count = 0;
+    if(view->key_data_length == 0){
         ESP_LOGD(TAG, "Empty Key Data");
-        return NULL;
+        return false;
     }
 
-    if(eapol_key->key_information.encrypted_key_data == 1){
+    if(view->eapol_key->key_information.encrypted_key_data == 1){
         ESP_LOGD(TAG, "Key Data encrypted");
-        return NULL;
+        return false;
     }
 
-    return parse_pmkid_from_key_data(eapol_key->key_data, ntohs(eapol_key->key_data_length));
-}
\ No newline at end of file
+    parse_pmkid_from_key_data(view->key_data, view->key_data_length, result);
+    return result->count > 0;
+}
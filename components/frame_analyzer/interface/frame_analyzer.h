@@ -10,6 +10,7 @@
 #define FRAME_ANALYZER_H
 
 #include "esp_event.h"
+#include "esp_wifi_types.h"
 
 ESP_EVENT_DECLARE_BASE(FRAME_ANALYZER_EVENTS);
 
@@ -28,13 +29,28 @@ typedef enum {
     SEARCH_PMKID
 } search_type_t;
 
+/**
+ * @brief Callback for EAPOL-Key frames captured in one sniffer batch.
+ * 
+ * It's called directly from sniffer task at the end of sniffer batch, so it shouldn't block.
+ * Frames are borrowed and valid only during the call.
+ * 
+ * @param frames EAPOL-Key frames in order of capture
+ * @param count number of frames, at most CONFIG_SNIFFER_BATCH_SIZE
+ */
+typedef void (*frame_analyzer_eapolkey_cb_t)(const wifi_promiscuous_pkt_t *const *frames, unsigned count);
+
 /**
  * @brief Starts frame analysis based on given search type and BSSID.
  * 
+ * If eapolkey_callback is given, EAPOL-Key frames are passed to it in sniffer task batch by batch instead of 
+ * being copied into DATA_FRAME_EVENT_EAPOLKEY_FRAME event, so they are processed on the core the sniffer task is pinned to.
+ * 
  * @param search_type type of information that are demanded
  * @param bssid target AP's BSSID
+ * @param eapolkey_callback optional callback for EAPOL-Key frames with SEARCH_HANDSHAKE, can be NULL
  */
-void frame_analyzer_capture_start(search_type_t search_type, const uint8_t *bssid);
+void frame_analyzer_capture_start(search_type_t search_type, const uint8_t *bssid, frame_analyzer_eapolkey_cb_t eapolkey_callback);
 
 /**
  * @brief stops frame analysis
@@ -14,44 +14,79 @@
 
 #include "frame_analyzer_types.h"
 
+/**
+ * @brief Bounds checked view of EAPoL-Key packet
+ * 
+ * Filled by parse_eapol_key_packet() that validates all lengths against the frame once, so the pointers 
+ * can be dereferenced without further checks. Pointers point into the frame buffer, nothing is copied.
+ */
+typedef struct {
+    const eapol_packet_t *eapol_packet;     ///< EAPoL packet including its header
+    unsigned eapol_length;                  ///< length of EAPoL packet including header
+    const eapol_key_packet_t *eapol_key;    ///< EAPoL-Key packet, all fixed fields are within the frame
+    const uint8_t *key_data;
+    unsigned key_data_length;               ///< host order value of eapol_key->key_data_length
+} eapol_key_view_t;
+
 /**
  * @brief Determines whether BSSID inside of the given frame matches given BSSID.
  * 
  * @param frame 
  * @param bssid 
- * @return bool 
+ * @return bool false also if frame is too short to contain BSSID
  */
-bool is_frame_bssid_matching(wifi_promiscuous_pkt_t *frame, uint8_t *bssid);
+bool is_frame_bssid_matching(const wifi_promiscuous_pkt_t *frame, const uint8_t *bssid);
 
 /**
- * @brief Parses EAPoL packet from given frame.
+ * @brief Parses EAPoL packet from given data frame.
  * 
- * @param frame 
- * @return eapol_packet_t* if parsing successful 
+ * QoS, HT Control and 4-address headers are skipped. Only bytes within given length are read.
+ * 
+ * @param frame data frame
+ * @param length length of frame buffer in bytes (e.g. rx_ctrl.sig_len)
+ * @param eapol_length output length of EAPoL packet including its header, guaranteed to fit into the frame
+ * @return const eapol_packet_t* if parsing successful 
  * @return \c NULL if no EAPoL packet was found
  * @return \c NULL if frame is protected
+ * @return \c NULL if frame is truncated
  */
-eapol_packet_t *parse_eapol_packet(data_frame_t *frame);
+const eapol_packet_t *parse_eapol_packet(const data_frame_t *frame, unsigned length, unsigned *eapol_length);
 
 /**
  * @brief Parses EAPoL-Key packet from EAPoL packet
  * 
- * @note result does not include EAPoL header
- * @param eapol_packet 
- * @return eapol_key_packet_t* if parsing successful
- * @return \c NULL if no EAPoL-Key packet found
+ * @param eapol_packet result of parse_eapol_packet()
+ * @param eapol_length length of EAPoL packet from parse_eapol_packet()
+ * @param view output view of EAPoL-Key packet, filled only if parsing successful
+ * @return true if parsing successful
+ * @return false if packet is not EAPoL-Key or it's truncated
  */
-eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet);
+bool parse_eapol_key_packet(const eapol_packet_t *eapol_packet, unsigned eapol_length, eapol_key_view_t *view);
+
+/**
+ * @brief Parses EAPoL-Key packet from given data frame.
+ * 
+ * Shortcut for parse_eapol_packet() followed by parse_eapol_key_packet().
+ * 
+ * @param frame data frame
+ * @param length length of frame buffer in bytes
+ * @param view output view of EAPoL-Key packet, filled only if parsing successful
+ * @return true if parsing successful
+ * @return false if frame doesn't contain complete EAPoL-Key packet
+ */
+bool parse_eapol_key_frame(const data_frame_t *frame, unsigned length, eapol_key_view_t *view);
 
 /**
  * @brief Parses PMKIDs from EAPoL-Key packet
  * 
- * @param eapol_key 
- * @return pmkid_item_t* linked list of PMKIDs if parsing successful
- * @return \c NULL if no key data present
- * @return \c NULL if key data are encrypted
- * @return \c NULL parsing fails
+ * Key data elements are walked only within key data length, truncated element ends parsing.
+ * PMKIDs above capacity of pmkid_result_t are ignored.
+ * 
+ * @param view view of EAPoL-Key packet
+ * @param result filled with found PMKIDs, count is set also on failure
+ * @return true if at least one PMKID was found
+ * @return false if no key data present, key data are encrypted or they contain no PMKID
  */
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key);
+bool parse_pmkid(const eapol_key_view_t *view, pmkid_result_t *result);
 
-#endif
\ No newline at end of file
+#endif
@@ -87,14 +87,10 @@ typedef struct {
 /**
  * Size: 2 bytes
  * @note unnamed fields are "reserved"
+ * @note Key Information is big endian, so its first byte holds bits 8-15. Bit fields of each byte are declared from the least significant bit.
  * @see Ref: 802.11-2016 [12.7.2]
  */
 typedef struct {
-    uint8_t key_descriptor_version:3;
-    uint8_t key_type:1;
-    uint8_t :2;
-    uint8_t install:1;
-    uint8_t key_ack:1;
     uint8_t key_mic:1;
     uint8_t secure:1;
     uint8_t error:1;
@@ -102,6 +98,11 @@ typedef struct {
     uint8_t encrypted_key_data:1;
     uint8_t smk_message:1;
     uint8_t :2;
+    uint8_t key_descriptor_version:3;
+    uint8_t key_type:1;
+    uint8_t :2;
+    uint8_t install:1;
+    uint8_t key_ack:1;
 } key_information_t;
 
 /**
@@ -128,10 +129,9 @@ typedef struct __attribute__((__packed__)) {
 #define KEY_DATA_TYPE 0xdd
 
 /**
- * @note Needs trailing byte due to casting to uint32_t and converting from netlong
  * @see Ref: 802.11-2016 [12.7.2, Table 12-6]
  */
-#define KEY_DATA_OUI_IEEE80211 0x00fac00
+#define KEY_DATA_OUI_IEEE80211 0x000fac
 
 /**
  * @see Ref: 802.11-2016 [12.7.2, Table 12-6]
@@ -144,17 +144,26 @@ typedef struct __attribute__((__packed__)) {
 typedef struct __attribute__((__packed__)) {
     uint8_t type;
     uint8_t length;
-    uint32_t oui:24;
-    uint32_t data_type:8;
+    uint8_t oui[3];
+    uint8_t data_type;
     uint8_t data[];
 } key_data_field_t;
 
 /**
- * @brief linked list of PMKIDs
+ * @brief Maximum number of PMKIDs kept from single Key Data.
+ * 
+ * AP sends just one PMKID KDE in M1, the rest of capacity is for APs that send more.
+ */
+#define PMKID_RESULT_MAX_COUNT 4
+
+/**
+ * @brief PMKIDs parsed from single EAPoL-Key packet.
+ * 
+ * It has fixed capacity, so it can be stored on stack and passed by value (e.g. as event data).
  */
-typedef struct pmkid_item {
-    uint8_t pmkid[16];
-    struct pmkid_item *next;
-} pmkid_item_t;
+typedef struct {
+    unsigned count;
+    uint8_t pmkid[PMKID_RESULT_MAX_COUNT][16];
+} pmkid_result_t;
 
 #endif
\ No newline at end of file
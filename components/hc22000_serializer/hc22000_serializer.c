@@ -0,0 +1,198 @@
+/**
+ * @file hc22000_serializer.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements hashcat 22000 serializer
+ *
+ * Line formats:
+ * @code{.unparsed}
+ * WPA*01*PMKID*MAC_AP*MAC_STA*ESSID***
+ * WPA*02*MIC*MAC_AP*MAC_STA*ESSID*ANONCE*EAPOL*MESSAGEPAIR
+ * @endcode
+ * All fields are hex encoded.
+ * PMKIDs are added by sniffer task or event loop and read by webserver, so the table is guarded by mutex.
+ */
+#include "hc22000_serializer.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+// frames are added in sniffer task, so it shares hot path log level of sniffer
+#define LOG_LOCAL_LEVEL CONFIG_SNIFFER_LOG_LEVEL
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "frame_analyzer_parser.h"
+#include "hccapx_serializer.h"
+
+static const char *TAG = "hc22000_serializer";
+
+/**
+ * @brief Stored PMKID
+ */
+typedef struct {
+    uint8_t mac_ap[6];
+    uint8_t mac_sta[6];
+    uint8_t pmkid[16];
+} pmkid_record_t;
+
+/**
+ * @brief Protects PMKIDs and ESSID, created on first init
+ */
+static SemaphoreHandle_t lock = NULL;
+static pmkid_record_t pmkids[CONFIG_HC22000_SERIALIZER_MAX_PMKIDS];
+static unsigned pmkid_count = 0;
+static uint8_t essid[32];
+static unsigned essid_len = 0;
+
+void hc22000_serializer_init(const uint8_t *ssid, unsigned size){
+    if(lock == NULL){
+        lock = xSemaphoreCreateMutex();
+        if(lock == NULL){
+            ESP_LOGE(TAG, "Error creating mutex!");
+            return;
+        }
+    }
+    if(size > sizeof(essid)){
+        size = sizeof(essid);
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    memcpy(essid, ssid, size);
+    essid_len = size;
+    pmkid_count = 0;
+    xSemaphoreGive(lock);
+}
+
+/**
+ * @brief Stores PMKID, lock has to be held.
+ */
+static void add_pmkid(const uint8_t *mac_ap, const uint8_t *mac_sta, const uint8_t *pmkid){
+    for(unsigned i = 0; i < pmkid_count; i++){
+        if((memcmp(pmkids[i].mac_ap, mac_ap, 6) == 0) && (memcmp(pmkids[i].mac_sta, mac_sta, 6) == 0)
+            && (memcmp(pmkids[i].pmkid, pmkid, 16) == 0)){
+            return;
+        }
+    }
+    if(pmkid_count >= CONFIG_HC22000_SERIALIZER_MAX_PMKIDS){
+        ESP_LOGW(TAG, "PMKID table is full");
+        return;
+    }
+    pmkid_record_t *record = &pmkids[pmkid_count++];
+    memcpy(record->mac_ap, mac_ap, 6);
+    memcpy(record->mac_sta, mac_sta, 6);
+    memcpy(record->pmkid, pmkid, 16);
+}
+
+void hc22000_serializer_add_pmkid(const uint8_t *mac_ap, const uint8_t *mac_sta, const uint8_t *pmkid){
+    if(lock == NULL){
+        ESP_LOGE(TAG, "HC22000 serializer is not initialised!");
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    add_pmkid(mac_ap, mac_sta, pmkid);
+    xSemaphoreGive(lock);
+}
+
+void hc22000_serializer_add_frame(const data_frame_t *frame, unsigned length){
+    eapol_key_view_t eapol_key;
+    if(!parse_eapol_key_frame(frame, length, &eapol_key)){
+        return;
+    }
+    // PMKID is sent only by AP in M1
+    if(memcmp(frame->mac_header.addr2, frame->mac_header.addr3, 6) != 0){
+        return;
+    }
+    pmkid_result_t pmkid_result;
+    if(!parse_pmkid(&eapol_key, &pmkid_result)){
+        return;
+    }
+    if(lock == NULL){
+        ESP_LOGE(TAG, "HC22000 serializer is not initialised!");
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for(unsigned i = 0; i < pmkid_result.count; i++){
+        add_pmkid(frame->mac_header.addr3, frame->mac_header.addr1, pmkid_result.pmkid[i]);
+    }
+    xSemaphoreGive(lock);
+}
+
+unsigned hc22000_serializer_get_count(){
+    if(lock == NULL){
+        return hccapx_serializer_get_count();
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    unsigned count = pmkid_count;
+    xSemaphoreGive(lock);
+    return count + hccapx_serializer_get_count();
+}
+
+/**
+ * @brief Appends hex encoded bytes followed by separator to the line
+ *
+ * @param line current end of line
+ * @param data
+ * @param size of data in bytes
+ * @param separator appended after data, nothing if \0
+ * @return char* new end of line
+ */
+static char *append_hex(char *line, const uint8_t *data, unsigned size, char separator){
+    static const char hex[] = "0123456789abcdef";
+    for(unsigned i = 0; i < size; i++){
+        *line++ = hex[data[i] >> 4];
+        *line++ = hex[data[i] & 0x0f];
+    }
+    if(separator != '\0'){
+        *line++ = separator;
+    }
+    return line;
+}
+
+/**
+ * @brief Formats line, lock has to be held.
+ */
+static unsigned format_line(unsigned index, char *buffer){
+    // guarded by lock and kept off caller's stack
+    static hccapx_t hccapx;
+    char *line = buffer;
+    if(index < pmkid_count){
+        const pmkid_record_t *record = &pmkids[index];
+        memcpy(line, "WPA*01*", 7);
+        line += 7;
+        line = append_hex(line, record->pmkid, 16, '*');
+        line = append_hex(line, record->mac_ap, 6, '*');
+        line = append_hex(line, record->mac_sta, 6, '*');
+        line = append_hex(line, essid, essid_len, '*');
+        memcpy(line, "**", 2);
+        line += 2;
+    }
+    else {
+        if(!hccapx_serializer_get(index - pmkid_count, &hccapx)){
+            return 0;
+        }
+        memcpy(line, "WPA*02*", 7);
+        line += 7;
+        line = append_hex(line, hccapx.keymic, 16, '*');
+        line = append_hex(line, hccapx.mac_ap, 6, '*');
+        line = append_hex(line, hccapx.mac_sta, 6, '*');
+        line = append_hex(line, hccapx.essid, hccapx.essid_len, '*');
+        line = append_hex(line, hccapx.nonce_ap, 32, '*');
+        // EAPoL in HCCAPX record has already zeroed MIC as required by this format
+        line = append_hex(line, hccapx.eapol, hccapx.eapol_len, '*');
+        line = append_hex(line, &hccapx.message_pair, 1, '\0');
+    }
+    *line++ = '\n';
+    *line = '\0';
+    return line - buffer;
+}
+
+unsigned hc22000_serializer_get_line(unsigned index, char *buffer, unsigned size){
+    if((size < HC22000_SERIALIZER_MAX_LINE_SIZE) || (lock == NULL)){
+        return 0;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    unsigned length = format_line(index, buffer);
+    xSemaphoreGive(lock);
+    return length;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file hc22000_serializer.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides interface to generate hashcat 22000 (WPA-PBKDF2-PMKID+EAPOL) formatted lines
+ *
+ * PMKIDs are stored by this component, handshakes are taken from hccapx_serializer records,
+ * so both result types can be provided in single file.
+ *
+ * @see Ref: https://hashcat.net/wiki/doku.php?id=cracking_wpawpa2
+ */
+#ifndef HC22000_SERIALIZER_H
+#define HC22000_SERIALIZER_H
+
+#include <stdint.h>
+
+#include "frame_analyzer_types.h"
+
+/**
+ * @brief Maximum length of single line including new line character and terminating \0
+ *
+ * WPA*02 line with 256 B EAPoL and 32 B ESSID is the longest one.
+ */
+#define HC22000_SERIALIZER_MAX_LINE_SIZE 720
+
+/**
+ * @brief Clears stored PMKIDs and sets ESSID for new PMKID lines.
+ *
+ * Handshake lines are not affected, they are cleared by hccapx_serializer_init().
+ * @param ssid SSID of AP from which PMKIDs will be comming
+ * @param size length of SSID string
+ */
+void hc22000_serializer_init(const uint8_t *ssid, unsigned size);
+
+/**
+ * @brief Stores PMKID of given AP and STA. Duplicates are ignored.
+ *
+ * @param mac_ap
+ * @param mac_sta
+ * @param pmkid 16 B PMKID
+ */
+void hc22000_serializer_add_pmkid(const uint8_t *mac_ap, const uint8_t *mac_sta, const uint8_t *pmkid);
+
+/**
+ * @brief Stores PMKIDs from key data of EAPoL-Key frame sent by AP (M1).
+ *
+ * Frames without PMKID are ignored, so all handshake frames can be passed.
+ * @param frame data frame with EAPoL-Key packet
+ * @param length length of frame buffer in bytes
+ */
+void hc22000_serializer_add_frame(const data_frame_t *frame, unsigned length);
+
+/**
+ * @brief Returns number of lines - WPA*01 for every PMKID and WPA*02 for every complete HCCAPX record.
+ *
+ * @return unsigned
+ */
+unsigned hc22000_serializer_get_count();
+
+/**
+ * @brief Formats line into given buffer. PMKID lines go first.
+ *
+ * @param index of line, lower than hc22000_serializer_get_count()
+ * @param buffer at least HC22000_SERIALIZER_MAX_LINE_SIZE long
+ * @param size of buffer
+ * @return unsigned length of line including new line character
+ * @return 0 if there is no such line or buffer is too small
+ */
+unsigned hc22000_serializer_get_line(unsigned index, char *buffer, unsigned size);
+
+#endif
@@ -5,17 +5,26 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Implements HCCAPX serializer
+ * 
+ * Every handshake is tracked in its own session keyed by AP MAC, STA MAC and replay counter of the handshake,
+ * so handshakes of multiple clients can be captured at the same time.
+ * Sessions are added to by sniffer task and read by webserver, so the table is guarded by mutex
+ * and records are copied out of it.
  */
 #include "hccapx_serializer.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#define LOG_LOCAL_LEVEL CONFIG_HCCAPX_SERIALIZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "frame_analyzer.h"
 #include "frame_analyzer_types.h"
 #include "frame_analyzer_parser.h"
+#include "metrics.h"
 
 /**
  * @brief Constants based on reference
@@ -28,32 +37,63 @@
 #define HCCAPX_KEYVER_WPA 1
 #define HCCAPX_KEYVER_WPA2 2
 #define HCCAPX_MAX_EAPOL_SIZE 256
+#define HCCAPX_MESSAGE_PAIR_NONE 255
 //@}
 
+/**
+ * @brief Bits of handshake messages seen in session
+ */
+#define MESSAGE_BIT(message) (1 << ((message) - 1))
+
 static char *TAG = "hccapx_serializer";
 
 /**
- * @brief Default values for hccapx buffer
+ * @brief State of single handshake
  */
-static hccapx_t hccapx = { 
-    .signature = HCCAPX_SIGNATURE, 
-    .version = 4, 
-    .message_pair = 255,
-    .keyver = HCCAPX_KEYVER_WPA2
-};
+typedef struct {
+    bool used;
+    uint64_t replay_counter;    ///< replay counter of M1 and M2, M3 and M4 have it incremented by one
+    uint8_t messages;           ///< MESSAGE_BIT of messages seen
+    uint8_t eapol_source;       ///< number of message from which EAPoL was saved, 0 if none
+    unsigned last_update;       ///< value of update_sequence when session was last updated
+    hccapx_t hccapx;
+} session_t;
 
 /**
- * @brief Stores last processed message
+ * @brief Message pair candidate
  */
-//@{
-static unsigned message_ap = 0;
-static unsigned message_sta = 0;
-//@}
+typedef struct {
+    uint8_t message_pair;
+    uint8_t messages;           ///< messages that have to be seen
+    uint8_t eapol_source;       ///< message EAPoL has to be saved from
+} message_pair_candidate_t;
+
+/**
+ * @brief Message pairs ordered from the best one.
+ * 
+ * EAPoL from M2 with ANonce confirmed by M3 (authorized handshake) is preferred.
+ * 
+ * @see Ref: https://hashcat.net/wiki/doku.php?id=hccapx
+ */
+static const message_pair_candidate_t message_pair_candidates[] = {
+    { 2, MESSAGE_BIT(2) | MESSAGE_BIT(3), 2 },
+    { 0, MESSAGE_BIT(1) | MESSAGE_BIT(2), 2 },
+    { 3, MESSAGE_BIT(2) | MESSAGE_BIT(3), 3 },
+    { 4, MESSAGE_BIT(3) | MESSAGE_BIT(4), 3 },
+    { 5, MESSAGE_BIT(3) | MESSAGE_BIT(4), 4 },
+    { 1, MESSAGE_BIT(1) | MESSAGE_BIT(4), 4 },
+};
+
+#define MESSAGE_PAIR_CANDIDATES (sizeof(message_pair_candidates) / sizeof(message_pair_candidates[0]))
 
 /**
- * @brief Stores number of message from which was the EAPoL packet saved.  
+ * @brief Protects sessions and ESSID, created on first init
  */
-static unsigned eapol_source = 0;
+static SemaphoreHandle_t lock = NULL;
+static session_t sessions[CONFIG_HCCAPX_SERIALIZER_MAX_SESSIONS];
+static unsigned update_sequence = 0;
+static uint8_t essid[32];
+static unsigned essid_len = 0;
 
 /**
  * @brief Says whether array contains only zero values or not
@@ -63,7 +103,7 @@ static unsigned eapol_source = 0;
  * @return true all values are zero
  * @return false some value is different from zero
  */
-static bool is_array_zero(uint8_t *array, unsigned size){
+static bool is_array_zero(const uint8_t *array, unsigned size){
     for(unsigned i = 0; i < size; i++){
         if(array[i] != 0){
             return false;
@@ -72,201 +112,222 @@ static bool is_array_zero(uint8_t *array, unsigned size){
     return true;
 }
 
-void hccapx_serializer_init(const uint8_t *ssid, unsigned size){
-    hccapx.essid_len = size;
-    memcpy(hccapx.essid, ssid, size);
-    hccapx.message_pair = 255;
-}
-
-hccapx_t *hccapx_serializer_get(){
-    if(hccapx.message_pair == 255){
-        return NULL;
-    }
-    
-    return &hccapx;
-}
-
 /**
- * @brief Saves EAPoL-Key frame into HCCAPX buffer
- * 
- * Also sets Key MIC value to the one present in the given EAPoL-Key packet
+ * @brief Returns rank of message pair, lower is better.
  * 
- * @param eapol_packet EAPoL packet to be saved that includes also EAPoL header
- * @param eapol_key_packet EAPoL-Key parsed to get key MIC from it
- * @return unsigned
- * @return 1 if error occured
- * @return 0 if successfully saved
+ * @param message_pair 
+ * @return unsigned 
  */
-static unsigned save_eapol(eapol_packet_t *eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    unsigned eapol_len = 0;
-    eapol_len = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
-    if(eapol_len > HCCAPX_MAX_EAPOL_SIZE){
-        ESP_LOGW(TAG, "EAPoL is too long (%u/%u)", eapol_len, HCCAPX_MAX_EAPOL_SIZE);
-        return 1;
+static unsigned message_pair_rank(uint8_t message_pair){
+    for(unsigned i = 0; i < MESSAGE_PAIR_CANDIDATES; i++){
+        if(message_pair_candidates[i].message_pair == message_pair){
+            return i;
+        }
     }
-    hccapx.eapol_len = eapol_len;
-    memcpy(hccapx.eapol, eapol_packet, hccapx.eapol_len);
-    memcpy(hccapx.keymic, eapol_key_packet->key_mic, 16);
-    // Clear key MIC from EAPoL packet so hashcat can calulate MIC without preprocessing.
-    // This is not documented in HCCAPX reference.
-    // But it's based on 802.11i-2004 [8.5.2/h] and by analysing behaviour of cap2hccapx tool
-    // MIC key on 77 bytes offset inside EAPoL-Key + 4 bytes EAPoL header.
-    memset(&hccapx.eapol[81], 0x0, 16);
-    return 0;
+    return MESSAGE_PAIR_CANDIDATES;
 }
 
-/**
- * @brief Handles first message of WPA handshake - from AP to STA
- * 
- * This message is from AP. It always contains ANonce.
- * 
- * @param eapol_key_packet parsed EAPoL-Key packet
- */
-static void ap_message_m1(eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From AP M1");
-    message_ap = 1;
-    memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
+void hccapx_serializer_init(const uint8_t *ssid, unsigned size){
+    if(lock == NULL){
+        lock = xSemaphoreCreateMutex();
+        if(lock == NULL){
+            ESP_LOGE(TAG, "Error creating mutex!");
+            return;
+        }
+    }
+    if(size > sizeof(essid)){
+        size = sizeof(essid);
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    memcpy(essid, ssid, size);
+    essid_len = size;
+    memset(sessions, 0, sizeof(sessions));
+    update_sequence = 0;
+    xSemaphoreGive(lock);
 }
 
 /**
- * @brief Handles third message of WPA handshake - from AP to STA
+ * @brief Says whether session holds the best complete message pair of its client.
  * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * If there are more complete sessions of the same client, the one with better message pair wins,
+ * on tie the most recently updated one.
+ * 
+ * @param session 
+ * @return true 
+ * @return false 
  */
-static void ap_message_m3(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From AP M3");
-    message_ap = 3;
-    if(message_ap == 0){
-        // No AP message was processed yet. ANonce has to be copied into HCCAPX buffer.
-        memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
+static bool is_best_session_of_client(const session_t *session){
+    if(!session->used || (session->hccapx.message_pair == HCCAPX_MESSAGE_PAIR_NONE)){
+        return false;
     }
-    if(eapol_source == 2){
-        // EAPoL packet was already saved from message #2. No need to resave it.
-        hccapx.message_pair = 2;
-        return;
+    unsigned rank = message_pair_rank(session->hccapx.message_pair);
+    for(unsigned i = 0; i < CONFIG_HCCAPX_SERIALIZER_MAX_SESSIONS; i++){
+        const session_t *other = &sessions[i];
+        if((other == session) || !other->used || (other->hccapx.message_pair == HCCAPX_MESSAGE_PAIR_NONE)){
+            continue;
+        }
+        if((memcmp(other->hccapx.mac_ap, session->hccapx.mac_ap, 6) != 0) || (memcmp(other->hccapx.mac_sta, session->hccapx.mac_sta, 6) != 0)){
+            continue;
+        }
+        unsigned other_rank = message_pair_rank(other->hccapx.message_pair);
+        if((other_rank < rank) || ((other_rank == rank) && (other->last_update > session->last_update))){
+            return false;
+        }
     }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
+    return true;
+}
+
+unsigned hccapx_serializer_get_count(){
+    if(lock == NULL){
+        return 0;
     }
-    eapol_source = 3;
-    if(message_sta == 2){
-        hccapx.message_pair = 3;
+    unsigned count = 0;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for(unsigned i = 0; i < CONFIG_HCCAPX_SERIALIZER_MAX_SESSIONS; i++){
+        if(is_best_session_of_client(&sessions[i])){
+            count++;
+        }
     }
+    xSemaphoreGive(lock);
+    return count;
 }
 
-/**
- * @brief Handles messages from AP - handshake M1 and M3.
- * 
- * @param frame 
- * @param eapol_packet 
- * @param eapol_key_packet 
- */
-static void ap_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if((!is_array_zero(hccapx.mac_sta, 6)) && (memcmp(frame->mac_header.addr1, hccapx.mac_sta, 6) != 0)){
-        ESP_LOGE(TAG, "Different STA");
-        return;
+bool hccapx_serializer_get(unsigned index, hccapx_t *hccapx){
+    if(lock == NULL){
+        return false;
     }
-    if(message_ap == 0){
-        memcpy(hccapx.mac_ap, frame->mac_header.addr2, 6);
-    }
-    // Determine which message this is by Key MIC
-    // Key MIC is always empty in M1 and always present in M3
-    // Ref: 802.11i-2004 [8.5.3]
-    if(is_array_zero(eapol_key_packet->key_mic, 16)){
-        ap_message_m1(eapol_key_packet);
-    } 
-    else {
-        ap_message_m3(eapol_packet, eapol_key_packet);
+    bool found = false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for(unsigned i = 0; i < CONFIG_HCCAPX_SERIALIZER_MAX_SESSIONS; i++){
+        if(is_best_session_of_client(&sessions[i]) && (index-- == 0)){
+            *hccapx = sessions[i].hccapx;
+            found = true;
+            break;
+        }
     }
+    xSemaphoreGive(lock);
+    return found;
 }
 
 /**
- * @brief Handles second message of handshake - from STA to AP.
+ * @brief Finds session of given handshake or creates new one.
  * 
- * Saves EAPoL packet as this is the first time key MIC is present.
- * Saves SNonce.
+ * If the table is full, least recently updated incomplete session is replaced.
  * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @param mac_ap 
+ * @param mac_sta 
+ * @param replay_counter replay counter of M1/M2 of the handshake
+ * @return session_t* 
+ * @return \c NULL if table is full of complete sessions
  */
-static void sta_message_m2(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From STA M2");
-    message_sta = 2;
-    memcpy(hccapx.nonce_sta, eapol_key_packet->key_nonce, 32);
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
+static session_t *get_session(const uint8_t *mac_ap, const uint8_t *mac_sta, uint64_t replay_counter){
+    session_t *free_session = NULL;
+    for(unsigned i = 0; i < CONFIG_HCCAPX_SERIALIZER_MAX_SESSIONS; i++){
+        session_t *session = &sessions[i];
+        if(!session->used){
+            if(free_session == NULL || free_session->used){
+                free_session = session;
+            }
+            continue;
+        }
+        if((session->replay_counter == replay_counter)
+            && (memcmp(session->hccapx.mac_ap, mac_ap, 6) == 0)
+            && (memcmp(session->hccapx.mac_sta, mac_sta, 6) == 0)){
+            return session;
+        }
+        if((session->hccapx.message_pair == HCCAPX_MESSAGE_PAIR_NONE)
+            && ((free_session == NULL) || (free_session->used && (session->last_update < free_session->last_update)))){
+            free_session = session;
+        }
     }
-    eapol_source = 2;
-    if(message_ap == 1){
-        hccapx.message_pair = 0;
-        return;
+    if(free_session == NULL){
+        ESP_LOGW(TAG, "Session table is full");
+        return NULL;
+    }
+    if(free_session->used){
+        ESP_LOGD(TAG, "Replacing incomplete session");
     }
+    memset(free_session, 0, sizeof(session_t));
+    free_session->used = true;
+    free_session->replay_counter = replay_counter;
+    free_session->hccapx.signature = HCCAPX_SIGNATURE;
+    free_session->hccapx.version = HCCAPX_VERSION;
+    free_session->hccapx.message_pair = HCCAPX_MESSAGE_PAIR_NONE;
+    free_session->hccapx.keyver = HCCAPX_KEYVER_WPA2;
+    free_session->hccapx.essid_len = essid_len;
+    memcpy(free_session->hccapx.essid, essid, essid_len);
+    memcpy(free_session->hccapx.mac_ap, mac_ap, 6);
+    memcpy(free_session->hccapx.mac_sta, mac_sta, 6);
+    return free_session;
 }
 
 /**
- * @brief Handles fourth message of the handshake. From STA to AP.
+ * @brief Saves EAPoL-Key frame into HCCAPX record of the session
  * 
+ * Also sets Key MIC value to the one present in the given EAPoL-Key packet
  * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @param session
+ * @param eapol_key view of EAPoL-Key packet, whole EAPoL packet including its header is saved and key MIC is taken from it
+ * @param message number of handshake message
  */
-static void sta_message_m4(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From STA M4");
-    if((message_sta == 2) && (eapol_source != 0)){
-        // If message 2 was already fully processed, there is no need to process M4 again 
-        ESP_LOGD(TAG, "Already have M2, not worth");
-        return;
-    }
-    if(message_ap == 0){
-        // If there was no AP message processed yet, ANonce will be always missing.
-        ESP_LOGE(TAG, "Not enought handshake messages received.");
-        return;
-    }
-    if(eapol_source == 3){
-        hccapx.message_pair = 4;
-        return;
-    }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
+static void save_eapol(session_t *session, const eapol_key_view_t *eapol_key, unsigned message){
+    unsigned eapol_len = eapol_key->eapol_length;
+    if(eapol_len > HCCAPX_MAX_EAPOL_SIZE){
+        ESP_LOGW(TAG, "EAPoL is too long (%u/%u)", eapol_len, HCCAPX_MAX_EAPOL_SIZE);
         return;
     }
-    eapol_source = 4;
-    if(message_ap == 1){
-        hccapx.message_pair = 1;
-    }
-    if(message_ap == 3){
-        hccapx.message_pair = 5;
-    }
+    hccapx_t *hccapx = &session->hccapx;
+    hccapx->eapol_len = eapol_len;
+    memcpy(hccapx->eapol, eapol_key->eapol_packet, eapol_len);
+    memcpy(hccapx->keymic, eapol_key->eapol_key->key_mic, 16);
+    // Clear key MIC from EAPoL packet so hashcat can calulate MIC without preprocessing.
+    // This is not documented in HCCAPX reference.
+    // But it's based on 802.11i-2004 [8.5.2/h] and by analysing behaviour of cap2hccapx tool
+    // MIC key on 77 bytes offset inside EAPoL-Key + 4 bytes EAPoL header.
+    memset(&hccapx->eapol[81], 0x0, 16);
+    session->eapol_source = message;
 }
 
 /**
- * @brief Handles messages from STA - M2 and M4
+ * @brief Updates session by handshake message and picks the best available message pair.
  * 
- * @param frame 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * ANonce is taken from M1 or M3, SNonce from M2. EAPoL is saved from the message that gives the best pairs - M2, then M3, then M4.
+ * 
+ * @param session 
+ * @param message number of handshake message (1-4)
+ * @param eapol_key 
  */
-static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if(is_array_zero(hccapx.mac_sta, 6)){
-        memcpy(hccapx.mac_sta, frame->mac_header.addr2, 6);
+static void update_session(session_t *session, unsigned message, const eapol_key_view_t *eapol_key){
+    ESP_LOGD(TAG, "M%u", message);
+    hccapx_t *hccapx = &session->hccapx;
+    session->messages |= MESSAGE_BIT(message);
+    session->last_update = ++update_sequence;
+    if((message == 1) || (message == 3)){
+        memcpy(hccapx->nonce_ap, eapol_key->eapol_key->key_nonce, 32);
     }
-    else if(memcmp(frame->mac_header.addr2, hccapx.mac_sta, 6) != 0){
-        ESP_LOGE(TAG, "Different STA");
-        return;
+    if(message == 2){
+        memcpy(hccapx->nonce_sta, eapol_key->eapol_key->key_nonce, 32);
     }
-    // Determine which message this is by SNonce
-    // SNonce is present in M2, empty in M4
-    // Ref: 802.11i-2004 [8.5.3]
-    if(!is_array_zero(eapol_key_packet->key_nonce, 16)){
-        sta_message_m2(eapol_packet, eapol_key_packet);
-    } 
-    else {
-        sta_message_m4(eapol_packet, eapol_key_packet);
+    // M1 has no MIC, so its EAPoL is never saved. Lower message number gives better pairs.
+    if((message != 1) && ((session->eapol_source == 0) || (message < session->eapol_source))){
+        save_eapol(session, eapol_key, message);
+    }
+    for(unsigned i = 0; i < MESSAGE_PAIR_CANDIDATES; i++){
+        const message_pair_candidate_t *candidate = &message_pair_candidates[i];
+        if(((session->messages & candidate->messages) != candidate->messages) || (session->eapol_source != candidate->eapol_source)){
+            continue;
+        }
+        if(hccapx->message_pair != candidate->message_pair){
+            ESP_LOGI(TAG, "Message pair %u", candidate->message_pair);
+            hccapx->message_pair = candidate->message_pair;
+            metrics_counter_inc(METRICS_HCCAPX_MESSAGE_PAIRS);
+        }
+        return;
     }
 }
 
 /**
- * @detail This component is a state machine, so this function can be used without knowing current state from outside.
+ * @detail Each handshake is a state machine in its own session, so this function can be used without knowing current state from outside.
  * WPA handshake pseudo-diagram:
  * @code{.unparsed}
  * AP           STA
@@ -277,18 +338,57 @@ static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol
  * @endcode
  * 
  * @param frame 
+ * @param length 
  */
-void hccapx_serializer_add_frame(data_frame_t *frame){
-    eapol_packet_t *eapol_packet = parse_eapol_packet(frame);
-    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
+void hccapx_serializer_add_frame(const data_frame_t *frame, unsigned length){
+    if(lock == NULL){
+        ESP_LOGE(TAG, "HCCAPX serializer is not initialised!");
+        return;
+    }
+    metrics_counter_inc(METRICS_HCCAPX_FRAMES);
+    eapol_key_view_t eapol_key;
+    if(!parse_eapol_key_frame(frame, length, &eapol_key)){
+        ESP_LOGE(TAG, "Not an EAPoL-Key frame.");
+        metrics_counter_inc(METRICS_HCCAPX_REJECTED);
+        return;
+    }
+    uint64_t replay_counter = 0;
+    for(unsigned i = 0; i < 8; i++){
+        replay_counter = (replay_counter << 8) | eapol_key.eapol_key->key_replay_counter[i];
+    }
+
+    const uint8_t *mac_sta;
+    unsigned message;
     // Determine direction of the frame by comparing BSSID (addr3) with source address (addr2)
     if(memcmp(frame->mac_header.addr2, frame->mac_header.addr3, 6) == 0){
-        ap_message(frame, eapol_packet, eapol_key_packet);
+        mac_sta = frame->mac_header.addr1;
+        // Key MIC is always empty in M1 and always present in M3
+        // Ref: 802.11i-2004 [8.5.3]
+        message = is_array_zero(eapol_key.eapol_key->key_mic, 16) ? 1 : 3;
     } 
     else if(memcmp(frame->mac_header.addr1, frame->mac_header.addr3, 6) == 0){
-        sta_message(frame, eapol_packet, eapol_key_packet);
+        mac_sta = frame->mac_header.addr2;
+        // SNonce is present in M2, empty in M4
+        // Ref: 802.11i-2004 [8.5.3]
+        message = is_array_zero(eapol_key.eapol_key->key_nonce, 32) ? 4 : 2;
     } 
     else {
         ESP_LOGE(TAG, "Unknown frame format. BSSID is not source nor destionation.");
+        metrics_counter_inc(METRICS_HCCAPX_REJECTED);
+        return;
+    }
+
+    // M3 and M4 use replay counter of M1 and M2 incremented by one
+    if(message >= 3){
+        replay_counter--;
     }
-}
\ No newline at end of file
+    xSemaphoreTake(lock, portMAX_DELAY);
+    session_t *session = get_session(frame->mac_header.addr3, mac_sta, replay_counter);
+    if(session != NULL){
+        update_session(session, message, &eapol_key);
+    }
+    xSemaphoreGive(lock);
+    if(session == NULL){
+        metrics_counter_inc(METRICS_HCCAPX_REJECTED);
+    }
+}
@@ -5,10 +5,14 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Provides interface to generate HCCAPX formatted binary from raw frame bytes 
+ * 
+ * Handshakes of multiple clients are tracked independently. Up to CONFIG_HCCAPX_SERIALIZER_MAX_SESSIONS
+ * handshakes are kept and the best message pair of each client is provided.
  */
 #ifndef HCCAPX_SERIALIZER_H
 #define HCCAPX_SERIALIZER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "frame_analyzer_types.h"
@@ -35,30 +39,43 @@ typedef struct __attribute__((__packed__)){
 } hccapx_t;
 
 /**
- * @brief Creates new HCCAPX buffer for given SSID.
+ * @brief Clears all tracked handshakes and sets SSID for new HCCAPX records.
  * 
- * This will clear any previous HCCAPX. If you want to save it, first call hccapx_serializer_get() and copy buffer somewhere else.
+ * This will clear any previous HCCAPX records. If you want to save them, first get them by hccapx_serializer_get() and copy them somewhere else.
  * @param ssid SSID of AP from which the handshake frames will be comming.
  * @param size length of SSID string (including \0)
  */
 void hccapx_serializer_init(const uint8_t *ssid, unsigned size);
 
 /**
- * @brief Returns pointer to buffer with HCCAPX formatted binary data 
+ * @brief Returns number of complete HCCAPX records - one with the best message pair per client.
+ * 
+ * @return unsigned 
+ */
+unsigned hccapx_serializer_get_count();
+
+/**
+ * @brief Copies complete HCCAPX record
+ * 
+ * Record is copied, as handshakes may be still captured while it's being read.
  * 
- * @return hccapx_t* 
+ * @param index of record, lower than hccapx_serializer_get_count()
+ * @param hccapx output record
+ * @return true if record was copied
+ * @return false if there is no such record
  */
-hccapx_t *hccapx_serializer_get();
+bool hccapx_serializer_get(unsigned index, hccapx_t *hccapx);
 
 /**
- * @brief Adds new handshake frames into current HCCAPX.
+ * @brief Adds new handshake frame into HCCAPX records.
  * 
- * This function will process given frames and extract data that are relevant.
- * If frame contains handshake from another STA than the one that was already added before,
- * frame will be skipped and error message will be printed.
+ * This function will process given frame and extract data that are relevant.
+ * Frame is assigned to handshake by AP MAC, STA MAC and replay counter, each handshake keeps its own M1-M4 state.
+ * Serializer has to be initialised by hccapx_serializer_init() first.
  * 
  * @param frame data frame with EAPoL-Key packet
+ * @param length length of frame buffer in bytes
  */
-void hccapx_serializer_add_frame(data_frame_t *frame);
+void hccapx_serializer_add_frame(const data_frame_t *frame, unsigned length);
 
 #endif
\ No newline at end of file
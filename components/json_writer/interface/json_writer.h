@@ -0,0 +1,121 @@
+/**
+ * @file json_writer.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Provides streaming JSON writer that doesn't allocate.
+ * 
+ * JSON is written into caller's buffer. When the buffer is full, it's passed to flush callback (e.g. httpd_resp_send_chunk()) 
+ * and reused, so documents of any size can be written by fixed amount of memory. Without flush callback the whole 
+ * document has to fit into the buffer. Commas between values are inserted by the writer.
+ * 
+ * Errors are sticky: after the first failed flush or buffer overflow all writes are ignored 
+ * and the error is returned by json_writer_finish().
+ */
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief Maximum nesting of objects and arrays
+ */
+#define JSON_WRITER_MAX_DEPTH 32
+
+/**
+ * @brief Callback writing part of serialized JSON.
+ * 
+ * @param ctx user context given to json_writer_init()
+ * @param data 
+ * @param length 
+ * @return esp_err_t writing stops on first error
+ */
+typedef esp_err_t (*json_writer_flush_t)(void *ctx, const char *data, unsigned length);
+
+/**
+ * @brief Writer state. Fields are private.
+ */
+typedef struct {
+    char *buffer;
+    unsigned size;
+    unsigned length;
+    json_writer_flush_t flush;
+    void *ctx;
+    esp_err_t err;
+    unsigned depth;
+    uint32_t has_values;    ///< bit per nesting level, set when level already contains a value
+    bool after_key;
+} json_writer_t;
+
+/**
+ * @brief Initializes writer.
+ * 
+ * @param writer 
+ * @param buffer output buffer, reused after every flush
+ * @param size size of buffer
+ * @param flush callback for full buffer, \c NULL if the whole document has to fit into the buffer
+ * @param ctx passed to flush callback
+ */
+void json_writer_init(json_writer_t *writer, char *buffer, unsigned size, json_writer_flush_t flush, void *ctx);
+
+/**
+ * @brief Opens and closes objects and arrays. Opened object or array is value of its parent.
+ * @{
+ */
+void json_writer_begin_object(json_writer_t *writer);
+void json_writer_end_object(json_writer_t *writer);
+void json_writer_begin_array(json_writer_t *writer);
+void json_writer_end_array(json_writer_t *writer);
+//@}
+
+/**
+ * @brief Writes object member name. It has to be followed by a value.
+ * 
+ * @param writer 
+ * @param key null terminated name, it's escaped
+ */
+void json_writer_key(json_writer_t *writer, const char *key);
+
+/**
+ * @brief Writes string value.
+ * 
+ * Quotation mark, backslash and control characters are escaped. Other bytes are written as they are.
+ * 
+ * @param writer 
+ * @param value null terminated string
+ */
+void json_writer_string(json_writer_t *writer, const char *value);
+
+/**
+ * @brief Writes number and boolean values.
+ * @{
+ */
+void json_writer_int(json_writer_t *writer, int64_t value);
+void json_writer_uint(json_writer_t *writer, uint64_t value);
+void json_writer_bool(json_writer_t *writer, bool value);
+//@}
+
+/**
+ * @brief Flushes rest of the buffer (if flush callback is set) and returns result of whole writing.
+ * 
+ * @param writer 
+ * @return ESP_OK document was written completely
+ * @return ESP_ERR_NO_MEM document doesn't fit into the buffer and no flush callback is set
+ * @return ESP_ERR_INVALID_STATE nesting exceeds JSON_WRITER_MAX_DEPTH or objects and arrays are not balanced
+ * @return error returned by flush callback
+ */
+esp_err_t json_writer_finish(json_writer_t *writer);
+
+/**
+ * @brief Returns length of data in the buffer.
+ * 
+ * Without flush callback it's length of the whole document, which is not null terminated.
+ * 
+ * @param writer 
+ * @return unsigned 
+ */
+unsigned json_writer_get_length(const json_writer_t *writer);
+
+#endif
@@ -0,0 +1,184 @@
+/**
+ * @file json_writer.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements streaming JSON writer.
+ */
+#include "json_writer.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+void json_writer_init(json_writer_t *writer, char *buffer, unsigned size, json_writer_flush_t flush, void *ctx){
+    writer->buffer = buffer;
+    writer->size = size;
+    writer->length = 0;
+    writer->flush = flush;
+    writer->ctx = ctx;
+    writer->err = ESP_OK;
+    writer->depth = 0;
+    writer->has_values = 0;
+    writer->after_key = false;
+}
+
+/**
+ * @brief Passes buffered data to flush callback and empties the buffer.
+ * 
+ * Without flush callback it only records overflow.
+ */
+static void flush(json_writer_t *writer){
+    if(writer->flush == NULL){
+        writer->err = ESP_ERR_NO_MEM;
+        return;
+    }
+    writer->err = writer->flush(writer->ctx, writer->buffer, writer->length);
+    writer->length = 0;
+}
+
+static void write_raw(json_writer_t *writer, const char *data, unsigned length){
+    while((writer->err == ESP_OK) && (length > 0)){
+        if(writer->length == writer->size){
+            flush(writer);
+            continue;
+        }
+        unsigned free_space = writer->size - writer->length;
+        unsigned part = (length < free_space) ? length : free_space;
+        memcpy(&writer->buffer[writer->length], data, part);
+        writer->length += part;
+        data += part;
+        length -= part;
+    }
+}
+
+static void write_char(json_writer_t *writer, char c){
+    write_raw(writer, &c, 1);
+}
+
+/**
+ * @brief Writes comma if current level already contains a value and marks the level as non empty.
+ */
+static void begin_value(json_writer_t *writer){
+    if(writer->after_key){
+        writer->after_key = false;
+        return;
+    }
+    if(writer->depth == 0){
+        return;
+    }
+    uint32_t level = 1u << (writer->depth - 1);
+    if(writer->has_values & level){
+        write_char(writer, ',');
+    }
+    writer->has_values |= level;
+}
+
+static void begin_container(json_writer_t *writer, char open){
+    begin_value(writer);
+    if(writer->depth == JSON_WRITER_MAX_DEPTH){
+        writer->err = ESP_ERR_INVALID_STATE;
+        return;
+    }
+    writer->depth++;
+    writer->has_values &= ~(1u << (writer->depth - 1));
+    write_char(writer, open);
+}
+
+static void end_container(json_writer_t *writer, char close){
+    if(writer->depth == 0){
+        writer->err = ESP_ERR_INVALID_STATE;
+        return;
+    }
+    writer->depth--;
+    write_char(writer, close);
+}
+
+static void write_escaped(json_writer_t *writer, const char *value){
+    static const char hex[] = "0123456789abcdef";
+    write_char(writer, '"');
+    const char *run = value;
+    for(; *value != '\0'; value++){
+        unsigned char c = (unsigned char) *value;
+        if((c >= 0x20) && (c != '"') && (c != '\\')){
+            continue;
+        }
+        // write unescaped characters in one piece
+        write_raw(writer, run, value - run);
+        run = value + 1;
+        if((c == '"') || (c == '\\')){
+            char escaped[2] = { '\\', c };
+            write_raw(writer, escaped, 2);
+        }
+        else {
+            char escaped[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf] };
+            write_raw(writer, escaped, 6);
+        }
+    }
+    write_raw(writer, run, value - run);
+    write_char(writer, '"');
+}
+
+void json_writer_begin_object(json_writer_t *writer){
+    begin_container(writer, '{');
+}
+
+void json_writer_end_object(json_writer_t *writer){
+    end_container(writer, '}');
+}
+
+void json_writer_begin_array(json_writer_t *writer){
+    begin_container(writer, '[');
+}
+
+void json_writer_end_array(json_writer_t *writer){
+    end_container(writer, ']');
+}
+
+void json_writer_key(json_writer_t *writer, const char *key){
+    begin_value(writer);
+    write_escaped(writer, key);
+    write_char(writer, ':');
+    writer->after_key = true;
+}
+
+void json_writer_string(json_writer_t *writer, const char *value){
+    begin_value(writer);
+    write_escaped(writer, value);
+}
+
+void json_writer_int(json_writer_t *writer, int64_t value){
+    char number[24];
+    begin_value(writer);
+    write_raw(writer, number, snprintf(number, sizeof(number), "%" PRId64, value));
+}
+
+void json_writer_uint(json_writer_t *writer, uint64_t value){
+    char number[24];
+    begin_value(writer);
+    write_raw(writer, number, snprintf(number, sizeof(number), "%" PRIu64, value));
+}
+
+void json_writer_bool(json_writer_t *writer, bool value){
+    begin_value(writer);
+    if(value){
+        write_raw(writer, "true", 4);
+    }
+    else {
+        write_raw(writer, "false", 5);
+    }
+}
+
+esp_err_t json_writer_finish(json_writer_t *writer){
+    if((writer->err == ESP_OK) && ((writer->depth != 0) || writer->after_key)){
+        writer->err = ESP_ERR_INVALID_STATE;
+    }
+    if((writer->err == ESP_OK) && (writer->flush != NULL) && (writer->length > 0)){
+        flush(writer);
+    }
+    return writer->err;
+}
+
+unsigned json_writer_get_length(const json_writer_t *writer){
+    return writer->length;
+}
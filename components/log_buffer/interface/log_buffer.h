@@ -0,0 +1,49 @@
+/**
+ * @file log_buffer.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides deferred logging sink.
+ *
+ * Log messages are formatted into RAM ring instead of being written to UART by the logging task.
+ * Low priority flush task writes them to console later, so logging never waits for UART.
+ * The ring keeps the most recent output, so it can be downloaded without serial cable.
+ */
+#ifndef LOG_BUFFER_H
+#define LOG_BUFFER_H
+
+#include "esp_err.h"
+
+/**
+ * @brief Callback writing part of log buffer content.
+ *
+ * @param ctx user context given to log_buffer_read()
+ * @param data
+ * @param length
+ * @return esp_err_t reading stops on first error
+ */
+typedef esp_err_t (*log_buffer_write_t)(void *ctx, const char *data, unsigned length);
+
+/**
+ * @brief Allocates log ring, starts flush task and redirects ESP-IDF logging into the ring.
+ *
+ * Should be called as early as possible, messages logged before are written to UART directly.
+ *
+ * @return esp_err_t ESP_ERR_NO_MEM if ring or flush task could not be allocated, logging stays unchanged
+ */
+esp_err_t log_buffer_init();
+
+/**
+ * @brief Passes whole content of log ring, from the oldest kept message, to given callback.
+ *
+ * Content is copied out in small chunks, logging is not blocked while callback runs.
+ * Content overwritten while reading is skipped, messages logged after reading started are not included.
+ *
+ * @param write called for every chunk
+ * @param ctx passed to write
+ * @return esp_err_t first error returned by write
+ * @return ESP_ERR_INVALID_STATE if log buffer is not initialised
+ */
+esp_err_t log_buffer_read(log_buffer_write_t write, void *ctx);
+
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file log_buffer.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements deferred logging sink.
+ */
+#include "log_buffer.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "alloc_policy.h"
+#include "metrics.h"
+#include "log_ring.h"
+
+static const char *TAG = "log_buffer";
+
+/**
+ * @brief Size of chunks copied out of the ring while it's locked
+ */
+#define READ_CHUNK_SIZE 128
+
+static log_ring_t log_ring;
+static portMUX_TYPE log_ring_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool initialised = false;
+
+/**
+ * @brief Replacement of ESP-IDF log output function.
+ *
+ * Runs in the logging task. Message is formatted on its stack and only copying into the ring
+ * is done in critical section, so it never waits for UART or for readers of the ring.
+ * Must not log itself.
+ *
+ * @param format
+ * @param args
+ * @return int number of bytes written into the ring
+ */
+static int log_buffer_vprintf(const char *format, va_list args){
+    char line[CONFIG_LOG_BUFFER_LINE_SIZE];
+    int length = vsnprintf(line, sizeof(line), format, args);
+    if(length < 0){
+        return length;
+    }
+    if(length >= (int) sizeof(line)){
+        // truncated message still ends the line
+        length = sizeof(line) - 1;
+        line[length - 1] = '\n';
+    }
+    portENTER_CRITICAL(&log_ring_lock);
+    log_ring_write(&log_ring, line, length);
+    portEXIT_CRITICAL(&log_ring_lock);
+    return length;
+}
+
+/**
+ * @brief Copies next chunk of the ring from given position.
+ *
+ * @param position
+ * @param chunk
+ * @param skipped
+ * @return unsigned
+ */
+static unsigned read_chunk(uint64_t *position, char *chunk, uint64_t *skipped){
+    portENTER_CRITICAL(&log_ring_lock);
+    unsigned length = log_ring_read(&log_ring, position, chunk, READ_CHUNK_SIZE, skipped);
+    portEXIT_CRITICAL(&log_ring_lock);
+    return length;
+}
+
+/**
+ * @brief Writes new content of the ring to console every CONFIG_LOG_BUFFER_FLUSH_INTERVAL.
+ *
+ * If logging outpaced UART and content was overwritten before it was written,
+ * number of lost bytes is written instead.
+ *
+ * @param args not used
+ */
+static void flush_task(void *args){
+    uint64_t position = 0;
+    char chunk[READ_CHUNK_SIZE];
+    for(;;){
+        vTaskDelay(pdMS_TO_TICKS(CONFIG_LOG_BUFFER_FLUSH_INTERVAL));
+        unsigned length;
+        uint64_t skipped;
+        while((length = read_chunk(&position, chunk, &skipped)) > 0 || skipped > 0){
+            if(skipped > 0){
+                metrics_counter_add(METRICS_LOG_BUFFER_DROPPED, skipped);
+                printf("\n... %" PRIu64 " B of log dropped ...\n", skipped);
+            }
+            fwrite(chunk, 1, length, stdout);
+        }
+        fflush(stdout);
+    }
+}
+
+esp_err_t log_buffer_init(){
+    char *buffer = alloc_policy_malloc(ALLOC_POLICY_SUBSYSTEM_LOG, CONFIG_LOG_BUFFER_SIZE);
+    if(buffer == NULL){
+        ESP_LOGE(TAG, "Couldn't allocate log ring!");
+        return ESP_ERR_NO_MEM;
+    }
+    log_ring_init(&log_ring, buffer, CONFIG_LOG_BUFFER_SIZE);
+    // kept off APP_CPU, where sniffer task runs
+    if(xTaskCreatePinnedToCore(&flush_task, "log_flush", 3072, NULL, CONFIG_LOG_BUFFER_FLUSH_TASK_PRIORITY, NULL, 0) != pdPASS){
+        ESP_LOGE(TAG, "Error creating flush task!");
+        free(buffer);
+        return ESP_ERR_NO_MEM;
+    }
+    initialised = true;
+    esp_log_set_vprintf(&log_buffer_vprintf);
+    ESP_LOGI(TAG, "Logging into %u B ring", CONFIG_LOG_BUFFER_SIZE);
+    return ESP_OK;
+}
+
+esp_err_t log_buffer_read(log_buffer_write_t write, void *ctx){
+    if(!initialised){
+        return ESP_ERR_INVALID_STATE;
+    }
+    portENTER_CRITICAL(&log_ring_lock);
+    uint64_t end = log_ring.head;
+    portEXIT_CRITICAL(&log_ring_lock);
+    uint64_t position = 0;
+    char chunk[READ_CHUNK_SIZE];
+    unsigned length;
+    uint64_t skipped;
+    // skipped bytes were overwritten while previous chunks were being written, reading continues from the tail
+    // reading stops at head from the start, so messages logged by write itself can't keep it going forever
+    while(position < end && (length = read_chunk(&position, chunk, &skipped)) > 0){
+        esp_err_t err = write(ctx, chunk, length);
+        if(err != ESP_OK){
+            return err;
+        }
+    }
+    return ESP_OK;
+}
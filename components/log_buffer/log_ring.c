@@ -0,0 +1,58 @@
+/**
+ * @file log_ring.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements byte ring of log output.
+ */
+#include "log_ring.h"
+
+#include <string.h>
+
+void log_ring_init(log_ring_t *ring, char *buffer, unsigned size){
+    ring->buffer = buffer;
+    ring->size = size;
+    ring->head = 0;
+}
+
+void log_ring_write(log_ring_t *ring, const char *data, unsigned length){
+    if(length > ring->size){
+        ring->head += length - ring->size;
+        data += length - ring->size;
+        length = ring->size;
+    }
+    unsigned offset = ring->head % ring->size;
+    unsigned first = ring->size - offset;
+    if(first > length){
+        first = length;
+    }
+    memcpy(&ring->buffer[offset], data, first);
+    memcpy(ring->buffer, &data[first], length - first);
+    ring->head += length;
+}
+
+uint64_t log_ring_tail(const log_ring_t *ring){
+    return ring->head > ring->size ? ring->head - ring->size : 0;
+}
+
+unsigned log_ring_read(const log_ring_t *ring, uint64_t *position, char *data, unsigned length, uint64_t *skipped){
+    uint64_t tail = log_ring_tail(ring);
+    *skipped = 0;
+    if(*position < tail){
+        *skipped = tail - *position;
+        *position = tail;
+    }
+    uint64_t available = ring->head - *position;
+    if(length > available){
+        length = available;
+    }
+    unsigned offset = *position % ring->size;
+    unsigned first = ring->size - offset;
+    if(first > length){
+        first = length;
+    }
+    memcpy(data, &ring->buffer[offset], first);
+    memcpy(&data[first], ring->buffer, length - first);
+    *position += length;
+    return length;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file log_ring.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides byte ring that keeps the most recent log output.
+ *
+ * Writer never waits for readers - when the ring is full, the oldest bytes are overwritten.
+ * Positions are absolute offsets in the whole written stream, so each reader keeps its own position
+ * and learns how many bytes were overwritten before it read them.
+ * Ring is not synchronized, caller serializes access.
+ */
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <stdint.h>
+
+/**
+ * @brief Ring of log output
+ */
+typedef struct {
+    char *buffer;
+    unsigned size;
+    uint64_t head;      ///< number of bytes ever written, position of the next written byte
+} log_ring_t;
+
+/**
+ * @brief Initialises empty ring over given buffer.
+ *
+ * @param ring
+ * @param buffer
+ * @param size of buffer
+ */
+void log_ring_init(log_ring_t *ring, char *buffer, unsigned size);
+
+/**
+ * @brief Appends data to ring, overwriting the oldest bytes if there is not enough space.
+ *
+ * If data are longer than the ring, only their end is kept.
+ *
+ * @param ring
+ * @param data
+ * @param length
+ */
+void log_ring_write(log_ring_t *ring, const char *data, unsigned length);
+
+/**
+ * @brief Returns position of the oldest byte still kept in ring.
+ *
+ * @param ring
+ * @return uint64_t
+ */
+uint64_t log_ring_tail(const log_ring_t *ring);
+
+/**
+ * @brief Copies bytes from given position up to the head of ring.
+ *
+ * If position points to bytes that were already overwritten, it's moved to the tail first.
+ *
+ * @param ring
+ * @param position read position, advanced by skipped and read bytes
+ * @param data output buffer
+ * @param length size of output buffer
+ * @param skipped number of overwritten bytes the position was moved over
+ * @return unsigned number of read bytes, 0 if position reached the head
+ */
+unsigned log_ring_read(const log_ring_t *ring, uint64_t *position, char *data, unsigned length, uint64_t *skipped);
+
+#endif
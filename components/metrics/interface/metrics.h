@@ -0,0 +1,157 @@
+/**
+ * @file metrics.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Provides counters of capture pipeline stages and their rendering in Prometheus text format.
+ * 
+ * Counters are lock-free and can be incremented from any context including promiscuous callback.
+ * Gauges are read by registered callbacks only when metrics are rendered.
+ * Latency histograms have fixed power of two buckets in microseconds, so observation is just a few instructions.
+ * Size histograms use the same power of two buckets for counts of items, e.g. frames processed in one batch.
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief Counters of capture pipeline stages.
+ * 
+ * Names and descriptions are defined in metrics.c.
+ */
+typedef enum {
+    METRICS_SNIFFER_FRAMES_RECEIVED,
+    METRICS_SNIFFER_FRAMES_MATCHED,
+    METRICS_SNIFFER_FRAMES_DROPPED,
+    METRICS_SNIFFER_FRAMES_DISPATCHED,
+    METRICS_FRAME_ANALYZER_FRAMES,
+    METRICS_FRAME_ANALYZER_EAPOL,
+    METRICS_FRAME_ANALYZER_EAPOLKEY,
+    METRICS_FRAME_ANALYZER_PMKID,
+    METRICS_FRAME_ANALYZER_EVENTS_POSTED,
+    METRICS_FRAME_ANALYZER_EVENTS_BLOCKED,
+    METRICS_FRAME_ANALYZER_EVENTS_FAILED,
+    METRICS_FRAME_ANALYZER_EVENTS_HANDLED,
+    METRICS_PCAP_FRAMES,
+    METRICS_PCAP_BYTES,
+    METRICS_PCAP_DROPPED,
+    METRICS_HCCAPX_FRAMES,
+    METRICS_HCCAPX_REJECTED,
+    METRICS_HCCAPX_MESSAGE_PAIRS,
+    METRICS_LOG_BUFFER_DROPPED,
+    METRICS_COUNTER_MAX
+} metrics_counter_t;
+
+/**
+ * @brief Latency histograms of hot path functions.
+ * 
+ * Names and descriptions are defined in metrics.c.
+ */
+typedef enum {
+    METRICS_HISTOGRAM_SNIFFER_FRAME_HANDLER,
+    METRICS_HISTOGRAM_FRAME_ANALYZER_DATA_FRAME_HANDLER,
+    METRICS_HISTOGRAM_EAPOLKEY_FRAME_HANDLER,
+    METRICS_HISTOGRAM_PCAP_APPEND_FRAME,
+    METRICS_HISTOGRAM_MAX
+} metrics_histogram_t;
+
+/**
+ * @brief Size histograms of batched processing.
+ * 
+ * Names and descriptions are defined in metrics.c.
+ */
+typedef enum {
+    METRICS_SIZE_HISTOGRAM_SNIFFER_BATCH,
+    METRICS_SIZE_HISTOGRAM_MAX
+} metrics_size_histogram_t;
+
+/**
+ * @brief Callback returning current value of a gauge.
+ */
+typedef unsigned (*metrics_gauge_read_t)();
+
+/**
+ * @brief Callback writing part of rendered metrics.
+ * 
+ * @param ctx user context given to metrics_render()
+ * @param data 
+ * @param length 
+ * @return esp_err_t rendering stops on first error
+ */
+typedef esp_err_t (*metrics_write_t)(void *ctx, const char *data, unsigned length);
+
+/**
+ * @brief Adds value to counter.
+ * 
+ * @param counter 
+ * @param value 
+ */
+void metrics_counter_add(metrics_counter_t counter, unsigned value);
+
+/**
+ * @brief Increments counter by one.
+ * 
+ * @param counter 
+ */
+void metrics_counter_inc(metrics_counter_t counter);
+
+/**
+ * @brief Returns current value of counter.
+ * 
+ * @param counter 
+ * @return unsigned 
+ */
+unsigned metrics_counter_get(metrics_counter_t counter);
+
+/**
+ * @brief Returns timestamp to be passed to metrics_histogram_observe().
+ * 
+ * @return uint32_t microseconds from esp_timer, wrapping
+ * @return 0 if latency histograms are disabled in menuconfig
+ */
+uint32_t metrics_histogram_start();
+
+/**
+ * @brief Records time elapsed since given timestamp into histogram.
+ * 
+ * Does nothing if latency histograms are disabled in menuconfig.
+ * 
+ * @param histogram 
+ * @param start timestamp from metrics_histogram_start()
+ */
+void metrics_histogram_observe(metrics_histogram_t histogram, uint32_t start);
+
+/**
+ * @brief Records value into size histogram.
+ * 
+ * Size histograms are always enabled.
+ * 
+ * @param histogram 
+ * @param value 
+ */
+void metrics_size_histogram_observe(metrics_size_histogram_t histogram, unsigned value);
+
+/**
+ * @brief Registers gauge that is read when metrics are rendered.
+ * 
+ * @param name metric name without prefix, has to be static string
+ * @param help metric description, has to be static string
+ * @param read 
+ * @return esp_err_t 
+ * @return ESP_ERR_NO_MEM if there is no free gauge slot
+ */
+esp_err_t metrics_register_gauge(const char *name, const char *help, metrics_gauge_read_t read);
+
+/**
+ * @brief Renders all counters, histograms, gauges and heap statistics in Prometheus text exposition format.
+ * 
+ * @see Ref: https://prometheus.io/docs/instrumenting/exposition_formats/
+ * @param write called for every rendered line
+ * @param ctx passed to write
+ * @return esp_err_t first error returned by write
+ */
+esp_err_t metrics_render(metrics_write_t write, void *ctx);
+
+#endif
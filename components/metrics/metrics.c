@@ -0,0 +1,289 @@
+/**
+ * @file metrics.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements capture pipeline metrics.
+ */
+#include "metrics.h"
+
+#include <stdatomic.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+static const char *TAG = "metrics";
+
+/**
+ * @brief Prefix of all metric names
+ */
+#define METRICS_PREFIX "wpt_"
+
+/**
+ * @brief Maximum number of registered gauges
+ */
+#define METRICS_MAX_GAUGES 8
+
+/**
+ * @brief Maximum length of single rendered line
+ */
+#define LINE_SIZE 320
+
+typedef struct {
+    const char *name;
+    const char *help;
+} metric_description_t;
+
+static const metric_description_t counter_descriptions[METRICS_COUNTER_MAX] = {
+    [METRICS_SNIFFER_FRAMES_RECEIVED] = { "sniffer_frames_received_total", "Frames delivered by radio to promiscuous callback" },
+    [METRICS_SNIFFER_FRAMES_MATCHED] = { "sniffer_frames_matched_total", "Frames matched by at least one sniffer filter" },
+    [METRICS_SNIFFER_FRAMES_DROPPED] = { "sniffer_frames_dropped_total", "Matched frames dropped because frame ring was full or frame was too big" },
+    [METRICS_SNIFFER_FRAMES_DISPATCHED] = { "sniffer_frames_dispatched_total", "Frames passed from frame ring to subscribers" },
+    [METRICS_FRAME_ANALYZER_FRAMES] = { "frame_analyzer_frames_total", "Frames of target BSSID received by frame analyzer" },
+    [METRICS_FRAME_ANALYZER_EAPOL] = { "frame_analyzer_eapol_total", "EAPOL packets parsed by frame analyzer" },
+    [METRICS_FRAME_ANALYZER_EAPOLKEY] = { "frame_analyzer_eapolkey_total", "EAPOL-Key packets parsed by frame analyzer" },
+    [METRICS_FRAME_ANALYZER_PMKID] = { "frame_analyzer_pmkid_total", "EAPOL-Key packets containing PMKID" },
+    [METRICS_FRAME_ANALYZER_EVENTS_POSTED] = { "frame_analyzer_events_posted_total", "Events posted to event loop by frame analyzer" },
+    [METRICS_FRAME_ANALYZER_EVENTS_BLOCKED] = { "frame_analyzer_events_blocked_total", "Event posts that had to wait for free space in event queue" },
+    [METRICS_FRAME_ANALYZER_EVENTS_FAILED] = { "frame_analyzer_events_failed_total", "Event posts that failed" },
+    [METRICS_FRAME_ANALYZER_EVENTS_HANDLED] = { "frame_analyzer_events_handled_total", "Frame analyzer events taken from event queue" },
+    [METRICS_PCAP_FRAMES] = { "pcap_frames_total", "Frames stored by PCAP serializer" },
+    [METRICS_PCAP_BYTES] = { "pcap_bytes_total", "Bytes of records stored by PCAP serializer" },
+    [METRICS_PCAP_DROPPED] = { "pcap_dropped_total", "Frames PCAP serializer failed to store" },
+    [METRICS_HCCAPX_FRAMES] = { "hccapx_frames_total", "EAPOL-Key frames processed by HCCAPX serializer" },
+    [METRICS_HCCAPX_REJECTED] = { "hccapx_rejected_total", "EAPOL-Key frames rejected by HCCAPX serializer" },
+    [METRICS_HCCAPX_MESSAGE_PAIRS] = { "hccapx_message_pairs_total", "Times HCCAPX serializer found or improved crackable message pair" },
+    [METRICS_LOG_BUFFER_DROPPED] = { "log_buffer_dropped_bytes_total", "Bytes of log overwritten in log ring before they were written to console" },
+};
+
+static atomic_uint counters[METRICS_COUNTER_MAX];
+
+/**
+ * @brief Number of finite histogram buckets. Upper bound of bucket i is 2^i microseconds.
+ */
+#define HISTOGRAM_BUCKETS 16
+
+static const metric_description_t histogram_descriptions[METRICS_HISTOGRAM_MAX] = {
+    [METRICS_HISTOGRAM_SNIFFER_FRAME_HANDLER] = { "sniffer_frame_handler_duration_seconds", "Time spent in promiscuous callback" },
+    [METRICS_HISTOGRAM_FRAME_ANALYZER_DATA_FRAME_HANDLER] = { "frame_analyzer_data_frame_handler_duration_seconds", "Time spent in frame analyzer data frame handler" },
+    [METRICS_HISTOGRAM_EAPOLKEY_FRAME_HANDLER] = { "eapolkey_frame_handler_duration_seconds", "Time spent in handshake attack EAPOL-Key frame handler" },
+    [METRICS_HISTOGRAM_PCAP_APPEND_FRAME] = { "pcap_append_frame_duration_seconds", "Time spent in PCAP serializer appending frame or batch of frames" },
+};
+
+/**
+ * @brief Number of finite size histogram buckets. Upper bound of bucket i is 2^i items.
+ */
+#define SIZE_HISTOGRAM_BUCKETS 9
+
+static const metric_description_t size_histogram_descriptions[METRICS_SIZE_HISTOGRAM_MAX] = {
+    [METRICS_SIZE_HISTOGRAM_SNIFFER_BATCH] = { "sniffer_batch_frames", "Frames dispatched by sniffer task in one batch" },
+};
+
+/**
+ * @brief Histogram state. Buckets are not cumulative, they are summed up when rendered.
+ */
+typedef struct {
+    atomic_uint buckets[HISTOGRAM_BUCKETS + 1];     ///< last bucket is +Inf
+    atomic_uint sum_usec;                           ///< wraps after ~71 minutes of total measured time, sum of items for size histograms
+} histogram_t;
+
+static histogram_t histograms[METRICS_HISTOGRAM_MAX];
+static histogram_t size_histograms[METRICS_SIZE_HISTOGRAM_MAX];
+
+typedef struct {
+    metric_description_t description;
+    metrics_gauge_read_t read;
+    atomic_bool ready;
+} gauge_t;
+
+static gauge_t gauges[METRICS_MAX_GAUGES];
+static atomic_uint gauge_count;
+
+void metrics_counter_add(metrics_counter_t counter, unsigned value){
+    atomic_fetch_add_explicit(&counters[counter], value, memory_order_relaxed);
+}
+
+void metrics_counter_inc(metrics_counter_t counter){
+    atomic_fetch_add_explicit(&counters[counter], 1, memory_order_relaxed);
+}
+
+unsigned metrics_counter_get(metrics_counter_t counter){
+    return atomic_load_explicit(&counters[counter], memory_order_relaxed);
+}
+
+uint32_t metrics_histogram_start(){
+#if CONFIG_METRICS_LATENCY_HISTOGRAMS
+    return (uint32_t) esp_timer_get_time();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Adds value into the smallest bucket with upper bound 2^i >= value
+ * 
+ * @param histogram 
+ * @param buckets number of finite buckets
+ * @param value 
+ */
+static inline void histogram_add(histogram_t *histogram, unsigned buckets, uint32_t value){
+    unsigned bucket = (value <= 1) ? 0 : 32 - __builtin_clz(value - 1);
+    if(bucket > buckets){
+        bucket = buckets;
+    }
+    atomic_fetch_add_explicit(&histogram->buckets[bucket], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&histogram->sum_usec, value, memory_order_relaxed);
+}
+
+void metrics_histogram_observe(metrics_histogram_t histogram, uint32_t start){
+#if CONFIG_METRICS_LATENCY_HISTOGRAMS
+    histogram_add(&histograms[histogram], HISTOGRAM_BUCKETS, (uint32_t) esp_timer_get_time() - start);
+#endif
+}
+
+void metrics_size_histogram_observe(metrics_size_histogram_t histogram, unsigned value){
+    histogram_add(&size_histograms[histogram], SIZE_HISTOGRAM_BUCKETS, value);
+}
+
+esp_err_t metrics_register_gauge(const char *name, const char *help, metrics_gauge_read_t read){
+    unsigned index = atomic_fetch_add(&gauge_count, 1);
+    if(index >= METRICS_MAX_GAUGES){
+        ESP_LOGE(TAG, "No free gauge slot for %s", name);
+        return ESP_ERR_NO_MEM;
+    }
+    gauges[index].description.name = name;
+    gauges[index].description.help = help;
+    gauges[index].read = read;
+    atomic_store_explicit(&gauges[index].ready, true, memory_order_release);
+    return ESP_OK;
+}
+
+/**
+ * @brief Writes formatted line
+ */
+static esp_err_t write_line(metrics_write_t write, void *ctx, const char *format, ...){
+    char line[LINE_SIZE];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if(length < 0){
+        return ESP_FAIL;
+    }
+    if(length >= (int) sizeof(line)){
+        ESP_LOGW(TAG, "Metrics line truncated");
+        length = sizeof(line) - 1;
+    }
+    return write(ctx, line, length);
+}
+
+/**
+ * @brief Renders single metric with its HELP and TYPE lines
+ */
+static esp_err_t render_metric(metrics_write_t write, void *ctx, const char *name, const char *help, const char *type, unsigned value){
+    return write_line(write, ctx, "# HELP " METRICS_PREFIX "%s %s\n# TYPE " METRICS_PREFIX "%s %s\n" METRICS_PREFIX "%s %u\n",
+        name, help, name, type, name, value);
+}
+
+/**
+ * @brief Renders histogram with cumulative buckets in seconds
+ */
+static esp_err_t render_histogram(metrics_write_t write, void *ctx, const metric_description_t *description, histogram_t *histogram){
+    const char *name = description->name;
+    esp_err_t err;
+    if((err = write_line(write, ctx, "# HELP " METRICS_PREFIX "%s %s\n# TYPE " METRICS_PREFIX "%s histogram\n", name, description->help, name)) != ESP_OK){
+        return err;
+    }
+    unsigned count = 0;
+    for(unsigned i = 0; i <= HISTOGRAM_BUCKETS; i++){
+        count += atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+        if(i < HISTOGRAM_BUCKETS){
+            err = write_line(write, ctx, METRICS_PREFIX "%s_bucket{le=\"0.%06u\"} %u\n", name, 1u << i, count);
+        }
+        else {
+            err = write_line(write, ctx, METRICS_PREFIX "%s_bucket{le=\"+Inf\"} %u\n", name, count);
+        }
+        if(err != ESP_OK){
+            return err;
+        }
+    }
+    unsigned sum_usec = atomic_load_explicit(&histogram->sum_usec, memory_order_relaxed);
+    return write_line(write, ctx, METRICS_PREFIX "%s_sum %u.%06u\n" METRICS_PREFIX "%s_count %u\n", 
+        name, sum_usec / 1000000, sum_usec % 1000000, name, count);
+}
+
+/**
+ * @brief Renders size histogram with cumulative buckets
+ */
+static esp_err_t render_size_histogram(metrics_write_t write, void *ctx, const metric_description_t *description, histogram_t *histogram){
+    const char *name = description->name;
+    esp_err_t err;
+    if((err = write_line(write, ctx, "# HELP " METRICS_PREFIX "%s %s\n# TYPE " METRICS_PREFIX "%s histogram\n", name, description->help, name)) != ESP_OK){
+        return err;
+    }
+    unsigned count = 0;
+    for(unsigned i = 0; i <= SIZE_HISTOGRAM_BUCKETS; i++){
+        count += atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+        if(i < SIZE_HISTOGRAM_BUCKETS){
+            err = write_line(write, ctx, METRICS_PREFIX "%s_bucket{le=\"%u\"} %u\n", name, 1u << i, count);
+        }
+        else {
+            err = write_line(write, ctx, METRICS_PREFIX "%s_bucket{le=\"+Inf\"} %u\n", name, count);
+        }
+        if(err != ESP_OK){
+            return err;
+        }
+    }
+    return write_line(write, ctx, METRICS_PREFIX "%s_sum %u\n" METRICS_PREFIX "%s_count %u\n", 
+        name, atomic_load_explicit(&histogram->sum_usec, memory_order_relaxed), name, count);
+}
+
+esp_err_t metrics_render(metrics_write_t write, void *ctx){
+    esp_err_t err;
+    for(unsigned i = 0; i < METRICS_COUNTER_MAX; i++){
+        if((err = render_metric(write, ctx, counter_descriptions[i].name, counter_descriptions[i].help, "counter", metrics_counter_get(i))) != ESP_OK){
+            return err;
+        }
+    }
+#if CONFIG_METRICS_LATENCY_HISTOGRAMS
+    for(unsigned i = 0; i < METRICS_HISTOGRAM_MAX; i++){
+        if((err = render_histogram(write, ctx, &histogram_descriptions[i], &histograms[i])) != ESP_OK){
+            return err;
+        }
+    }
+#endif
+    for(unsigned i = 0; i < METRICS_SIZE_HISTOGRAM_MAX; i++){
+        if((err = render_size_histogram(write, ctx, &size_histogram_descriptions[i], &size_histograms[i])) != ESP_OK){
+            return err;
+        }
+    }
+    for(unsigned i = 0; i < METRICS_MAX_GAUGES; i++){
+        if(!atomic_load_explicit(&gauges[i].ready, memory_order_acquire)){
+            continue;
+        }
+        if((err = render_metric(write, ctx, gauges[i].description.name, gauges[i].description.help, "gauge", gauges[i].read())) != ESP_OK){
+            return err;
+        }
+    }
+    const struct {
+        const char *name;
+        const char *help;
+        unsigned value;
+    } heap_gauges[] = {
+        { "heap_internal_free_bytes", "Free internal heap", heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) },
+        { "heap_internal_minimum_free_bytes", "Lowest free internal heap since boot (high-water mark)", heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) },
+        { "heap_spiram_free_bytes", "Free SPIRAM heap", heap_caps_get_free_size(MALLOC_CAP_SPIRAM) },
+        { "heap_spiram_minimum_free_bytes", "Lowest free SPIRAM heap since boot (high-water mark)", heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM) },
+    };
+    for(unsigned i = 0; i < sizeof(heap_gauges) / sizeof(heap_gauges[0]); i++){
+        if((err = render_metric(write, ctx, heap_gauges[i].name, heap_gauges[i].help, "gauge", heap_gauges[i].value)) != ESP_OK){
+            return err;
+        }
+    }
+    return ESP_OK;
+}
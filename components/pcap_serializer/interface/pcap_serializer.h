@@ -5,11 +5,16 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Provides interface to generate PCAP formatted binary from raw frame bytes 
+ * 
+ * File format is chosen by CONFIG_PCAP_SERIALIZER_FORMAT_* option - classic PCAP with plain 802.11 frames
+ * or PCAPNG with radiotap header built from wifi_pkt_rx_ctrl_t of every frame.
  */
 #ifndef PCAP_SERIALIZER_H
 #define PCAP_SERIALIZER_H
 
 #include <stdint.h>
+#include "esp_err.h"
+#include "esp_wifi_types.h"
 
 /**
  * @brief PCAP global header
@@ -38,24 +43,49 @@ typedef struct {
         uint32_t orig_len;       /* actual length of packet */
 } pcap_record_header_t;
 
+/**
+ * @brief Frame appended by pcap_serializer_append_frames()
+ */
+typedef struct {
+    const uint8_t *buffer;                  ///< frame buffer
+    unsigned size;                          ///< size of frame buffer
+    uint64_t ts_usec;                       ///< timestamp of captured frame in microseconds (see capture_clock component)
+    const wifi_pkt_rx_ctrl_t *rx_ctrl;      ///< metadata of received frame, can be \c NULL
+} pcap_serializer_frame_t;
+
 /**
  * @brief Prepares new empty buffer for PCAP formatted binary data. 
  * 
  * Has always to be called before pcap_serializer_append_frame()
- * @return uint8_t* pointer to newly allocated PCAP buffer.
- * @return \c NULL initialisation failed
+ * @param comment comment of the capture stored in PCAPNG section header, can be \c NULL. Ignored by classic PCAP.
+ * @return ESP_OK on success
+ * @return ESP_ERR_NO_MEM initialisation failed
  */
-uint8_t *pcap_serializer_init();
+esp_err_t pcap_serializer_init(const char *comment);
 
 /**
  * @brief Appends new frame to existing PCAP buffer.
  * 
- * Expects pcap_serializer_append_frame() was already called.
+ * Expects pcap_serializer_init() was already called.
+ * If the frame doesn't fit under CONFIG_PCAP_SERIALIZER_MAX_SIZE or memory cannot be allocated, frame is dropped.
  * @param buffer frame buffer that should be appended to PCAP
  * @param size size of frame buffer
- * @param ts_usec timestamp of captured frame in microseconds
+ * @param ts_usec timestamp of captured frame in microseconds (see capture_clock component)
+ * @param rx_ctrl metadata of received frame stored in PCAPNG radiotap header, can be \c NULL. Ignored by classic PCAP.
  */
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec);
+void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, uint64_t ts_usec, const wifi_pkt_rx_ctrl_t *rx_ctrl);
+
+/**
+ * @brief Appends batch of frames to existing PCAP buffer.
+ * 
+ * Records of the batch are written to storage together, so storage is locked once per batch instead of once per frame.
+ * If the batch doesn't fit as whole, frames are appended one by one, so frames that fit are kept and the rest is dropped.
+ * Result is the same as calling pcap_serializer_append_frame() for every frame.
+ * 
+ * @param frames 
+ * @param count 
+ */
+void pcap_serializer_append_frames(const pcap_serializer_frame_t *frames, unsigned count);
 
 /**
  * @brief Frees PCAP buffer and resets all values.
@@ -73,10 +103,36 @@ void pcap_serializer_deinit();
 unsigned pcap_serializer_get_size();
 
 /**
- * @brief Return pointer to PCAP buffer
+ * @brief Returns number of frames that were dropped since pcap_serializer_init()
+ * 
+ * @return unsigned
+ */
+unsigned pcap_serializer_get_dropped_count();
+
+/**
+ * @brief Returns generation of PCAP buffer, it's increased every time the buffer is reset.
+ * 
+ * PCAP buffer is only appended to, so data read with the same generation never change. 
+ * Generation is increased before the buffer is reset, so reader can check it after pcap_serializer_read() 
+ * to make sure copied data belong to the same capture.
+ * 
+ * @return unsigned
+ */
+unsigned pcap_serializer_get_generation();
+
+/**
+ * @brief Copies part of PCAP buffer starting at given offset into caller's buffer.
+ * 
+ * Data are copied while storage is locked, so the copy stays valid even if capture continues 
+ * or new capture is started by pcap_serializer_init(). To read whole buffer, call this function 
+ * repeatedly with offset increased by returned length until it returns 0.
  * 
- * @return uint8_t* 
+ * @param offset offset from the beginning of PCAP binary in bytes
+ * @param buffer output buffer
+ * @param size size of output buffer
+ * @return unsigned number of bytes copied, less than size only at the end of PCAP buffer
+ * @return 0 if offset is beyond PCAP buffer size
  */
-uint8_t *pcap_serializer_get_buffer();
+unsigned pcap_serializer_read(unsigned offset, uint8_t *buffer, unsigned size);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+/**
+ * @file pcap_format.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Provides internal interface of PCAP file formats.
+ * 
+ * Format formats file header and records and writes them to storage (see pcap_storage.h).
+ * Format is chosen at compile time by CONFIG_PCAP_SERIALIZER_FORMAT_* option.
+ */
+#ifndef PCAP_FORMAT_H
+#define PCAP_FORMAT_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_wifi_types.h"
+
+#include "pcap_serializer.h"
+
+/**
+ * @brief Maximum length of stored packet according to references of both formats
+ */
+#define SNAPLEN 65535
+
+/**
+ * @brief Writes file header to empty storage.
+ * 
+ * @param comment comment of the capture, can be \c NULL
+ * @return ESP_OK on success
+ */
+esp_err_t pcap_format_write_header(const char *comment);
+
+/**
+ * @brief Maximum number of records written by single pcap_format_write_records() call.
+ * 
+ * Record headers of the whole batch are kept on stack of the caller.
+ */
+#define PCAP_FORMAT_MAX_RECORDS 8
+
+/**
+ * @brief Formats records of the frames and writes them to storage by single pcap_storage_write().
+ * 
+ * Records are either all stored or none of them.
+ * 
+ * @param frames non-empty frames
+ * @param count number of frames, at most PCAP_FORMAT_MAX_RECORDS
+ * @param written output number of bytes written to storage
+ * @return ESP_OK on success
+ * @return error of pcap_storage_write()
+ */
+esp_err_t pcap_format_write_records(const pcap_serializer_frame_t *frames, unsigned count, unsigned *written);
+
+#endif
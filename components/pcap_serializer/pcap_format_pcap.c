@@ -0,0 +1,72 @@
+/**
+ * @file pcap_format_pcap.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements classic PCAP format with LINKTYPE_IEEE802_11.
+ * 
+ * Frame metadata and comments are not supported by this format and are omitted.
+ */
+#include "pcap_format.h"
+#include "pcap_storage.h"
+#include "pcap_serializer.h"
+
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+#if CONFIG_PCAP_SERIALIZER_FORMAT_PCAP
+
+/**
+ * @brief Constanst according to reference
+ * 
+ * @see Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
+ */
+#define PCAP_MAGIC_NUMBER 0xa1b2c3d4
+
+/**
+ * @brief Constanst according to reference
+ * 
+ * @see Ref: http://www.tcpdump.org/linktypes.html (LINKTYPE_IEEE802_11)
+ */
+#define LINKTYPE_IEEE802_11 105
+
+esp_err_t pcap_format_write_header(const char *comment){
+    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
+    pcap_global_header_t pcap_global_header = {
+        .magic_number = PCAP_MAGIC_NUMBER,
+        .version_major = 2,
+        .version_minor = 4,
+        .thiszone = 0,
+        .sigfigs = 0,
+        .snaplen = SNAPLEN,
+        .network = LINKTYPE_IEEE802_11
+    };
+    const pcap_storage_part_t part = { &pcap_global_header, sizeof(pcap_global_header_t) };
+    return pcap_storage_write(&part, 1);
+}
+
+esp_err_t pcap_format_write_records(const pcap_serializer_frame_t *frames, unsigned count, unsigned *written){
+    pcap_record_header_t headers[PCAP_FORMAT_MAX_RECORDS];
+    pcap_storage_part_t parts[2 * PCAP_FORMAT_MAX_RECORDS];
+    *written = 0;
+    for(unsigned i = 0; i < count; i++){
+        unsigned size = frames[i].size;
+        // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#record-packet-header
+        headers[i].ts_sec = frames[i].ts_usec / 1000000;
+        headers[i].ts_usec = frames[i].ts_usec % 1000000;
+        headers[i].orig_len = size;
+        // Stored packet/frame cannot be larger than SNAPLEN
+        if(size > SNAPLEN){
+            size = SNAPLEN;
+        }
+        headers[i].incl_len = size;
+        parts[2 * i] = (pcap_storage_part_t) { &headers[i], sizeof(pcap_record_header_t) };
+        parts[2 * i + 1] = (pcap_storage_part_t) { frames[i].buffer, size };
+        *written += sizeof(pcap_record_header_t) + size;
+    }
+    // Record headers and frames are written at once, so record is never stored partially
+    return pcap_storage_write(parts, 2 * count);
+}
+
+#endif
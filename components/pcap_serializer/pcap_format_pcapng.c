@@ -0,0 +1,377 @@
+/**
+ * @file pcap_format_pcapng.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements PCAPNG format with LINKTYPE_IEEE802_11_RADIOTAP.
+ * 
+ * File consists of Section Header Block, single Interface Description Block and Enhanced Packet Block per frame.
+ * Every frame is prefixed by radiotap header with radio timestamp, signal, noise, channel and rate taken from wifi_pkt_rx_ctrl_t.
+ * Radiotap header is filled into precomputed template on stack, so no allocation is done per frame.
+ * 
+ * Blocks are stored in host byte order, radiotap header is always little endian. Both are the same on ESP32.
+ * 
+ * @see Ref: https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html
+ * @see Ref: https://www.radiotap.org/
+ */
+#include "pcap_format.h"
+#include "pcap_storage.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+#if CONFIG_PCAP_SERIALIZER_FORMAT_PCAPNG
+
+/**
+ * @brief Constants according to PCAPNG reference
+ */
+//@{
+#define BLOCK_TYPE_SECTION_HEADER 0x0a0d0d0a
+#define BLOCK_TYPE_INTERFACE_DESCRIPTION 0x00000001
+#define BLOCK_TYPE_ENHANCED_PACKET 0x00000006
+#define BYTE_ORDER_MAGIC 0x1a2b3c4d
+#define OPTION_END_OF_OPTIONS 0
+#define OPTION_COMMENT 1
+#define OPTION_SHB_HARDWARE 2
+#define OPTION_SHB_USER_APPLICATION 4
+#define OPTION_IF_NAME 2
+//@}
+
+/**
+ * @brief Constanst according to reference
+ * 
+ * @see Ref: http://www.tcpdump.org/linktypes.html (LINKTYPE_IEEE802_11_RADIOTAP)
+ */
+#define LINKTYPE_IEEE802_11_RADIOTAP 127
+
+/**
+ * @brief Radiotap present bits, flags and channel flags according to reference
+ * 
+ * @see Ref: https://www.radiotap.org/fields/defined
+ */
+//@{
+#define RADIOTAP_PRESENT_TSFT (1 << 0)
+#define RADIOTAP_PRESENT_FLAGS (1 << 1)
+#define RADIOTAP_PRESENT_RATE (1 << 2)
+#define RADIOTAP_PRESENT_CHANNEL (1 << 3)
+#define RADIOTAP_PRESENT_DBM_ANTSIGNAL (1 << 5)
+#define RADIOTAP_PRESENT_DBM_ANTNOISE (1 << 6)
+#define RADIOTAP_PRESENT_ANTENNA (1 << 11)
+#define RADIOTAP_PRESENT_MCS (1 << 19)
+#define RADIOTAP_FLAGS_SHORT_PREAMBLE 0x02
+#define RADIOTAP_FLAGS_FCS 0x10
+#define RADIOTAP_CHANNEL_CCK 0x0020
+#define RADIOTAP_CHANNEL_OFDM 0x0040
+#define RADIOTAP_CHANNEL_2GHZ 0x0080
+#define RADIOTAP_MCS_KNOWN_BANDWIDTH 0x01
+#define RADIOTAP_MCS_KNOWN_INDEX 0x02
+#define RADIOTAP_MCS_KNOWN_GUARD_INTERVAL 0x04
+#define RADIOTAP_MCS_KNOWN_FEC 0x10
+#define RADIOTAP_MCS_KNOWN_STBC 0x20
+#define RADIOTAP_MCS_FLAGS_BANDWIDTH_40 0x01
+#define RADIOTAP_MCS_FLAGS_SHORT_GI 0x04
+#define RADIOTAP_MCS_FLAGS_FEC_LDPC 0x10
+#define RADIOTAP_MCS_FLAGS_STBC_SHIFT 5
+//@}
+
+/**
+ * @brief Values of wifi_pkt_rx_ctrl_t.sig_mode
+ */
+#define SIG_MODE_NON_HT 0
+
+/**
+ * @brief Maximum length of options of one block
+ */
+#define MAX_OPTIONS_SIZE 320
+
+/**
+ * @brief Generic block header
+ */
+typedef struct {
+    uint32_t block_type;
+    uint32_t block_total_length;
+} block_header_t;
+
+/**
+ * @brief Section Header Block without options and trailing length
+ */
+typedef struct {
+    block_header_t header;
+    uint32_t byte_order_magic;
+    uint16_t major_version;
+    uint16_t minor_version;
+    int64_t section_length;
+} section_header_block_t;
+
+/**
+ * @brief Interface Description Block without options and trailing length
+ */
+typedef struct {
+    block_header_t header;
+    uint16_t link_type;
+    uint16_t reserved;
+    uint32_t snap_len;
+} interface_description_block_t;
+
+/**
+ * @brief Enhanced Packet Block without packet data, options and trailing length
+ */
+typedef struct {
+    block_header_t header;
+    uint32_t interface_id;
+    uint32_t timestamp_high;
+    uint32_t timestamp_low;
+    uint32_t captured_length;
+    uint32_t original_length;
+} enhanced_packet_block_t;
+
+/**
+ * @brief Radiotap header with fields in order of their present bits.
+ * 
+ * Offsets satisfy alignment required by radiotap. For non-HT frames MCS field is left out by shorter length,
+ * for HT frames rate is left out and its byte becomes alignment padding of channel field.
+ */
+typedef struct __attribute__((__packed__)) {
+    uint8_t version;
+    uint8_t pad;
+    uint16_t length;
+    uint32_t present;
+    uint64_t tsft;
+    uint8_t flags;
+    uint8_t rate;
+    uint16_t channel_frequency;
+    uint16_t channel_flags;
+    int8_t antenna_signal;
+    int8_t antenna_noise;
+    uint8_t antenna;
+    uint8_t mcs_known;
+    uint8_t mcs_flags;
+    uint8_t mcs_index;
+} radiotap_header_t;
+
+_Static_assert(offsetof(radiotap_header_t, tsft) % 8 == 0, "TSFT has to be 8 byte aligned");
+_Static_assert(offsetof(radiotap_header_t, channel_frequency) % 2 == 0, "Channel has to be 2 byte aligned");
+
+/**
+ * @brief Radiotap lengths and present bits of frames with and without metadata
+ */
+//@{
+#define RADIOTAP_LENGTH_NO_METADATA offsetof(radiotap_header_t, tsft)
+#define RADIOTAP_LENGTH_NON_HT offsetof(radiotap_header_t, mcs_known)
+#define RADIOTAP_LENGTH_HT sizeof(radiotap_header_t)
+#define RADIOTAP_PRESENT_COMMON (RADIOTAP_PRESENT_TSFT | RADIOTAP_PRESENT_FLAGS | RADIOTAP_PRESENT_CHANNEL \
+                                | RADIOTAP_PRESENT_DBM_ANTSIGNAL | RADIOTAP_PRESENT_DBM_ANTNOISE | RADIOTAP_PRESENT_ANTENNA)
+//@}
+
+static const radiotap_header_t radiotap_template = {
+    .version = 0,
+    .pad = 0,
+    .length = RADIOTAP_LENGTH_NON_HT,
+    .present = RADIOTAP_PRESENT_COMMON | RADIOTAP_PRESENT_RATE,
+    .flags = RADIOTAP_FLAGS_FCS,
+    .channel_flags = RADIOTAP_CHANNEL_2GHZ,
+};
+
+/**
+ * @brief Non-HT rates of wifi_pkt_rx_ctrl_t.rate index in 500 kbps units
+ * 
+ * @see wifi_phy_rate_t
+ */
+static const uint8_t legacy_rates[16] = { 2, 4, 11, 22, 0, 4, 11, 22, 96, 48, 24, 12, 108, 72, 36, 18 };
+
+/**
+ * @brief Appends option to options buffer. Value that doesn't fit is truncated.
+ * 
+ * @param options buffer of MAX_OPTIONS_SIZE bytes
+ * @param offset current length of options
+ * @param code option code
+ * @param value 
+ * @param length of value
+ * @return unsigned new length of options
+ */
+static unsigned append_option(uint8_t *options, unsigned offset, uint16_t code, const void *value, unsigned length){
+    // leave space for option header and end of options
+    const unsigned reserved = 4 * sizeof(uint16_t);
+    if(offset + reserved >= MAX_OPTIONS_SIZE){
+        return offset;
+    }
+    unsigned capacity = (MAX_OPTIONS_SIZE - offset - reserved) & ~3u;
+    if(length > capacity){
+        length = capacity;
+    }
+    const uint16_t header[2] = { code, length };
+    memcpy(&options[offset], header, sizeof(header));
+    offset += sizeof(header);
+    memcpy(&options[offset], value, length);
+    memset(&options[offset + length], 0, (4 - length % 4) % 4);
+    return offset + ((length + 3) & ~3u);
+}
+
+/**
+ * @brief Terminates options by end of options option
+ * 
+ * @param options 
+ * @param offset current length of options
+ * @return unsigned final length of options
+ */
+static unsigned end_options(uint8_t *options, unsigned offset){
+    memset(&options[offset], 0, 2 * sizeof(uint16_t));
+    return offset + 2 * sizeof(uint16_t);
+}
+
+esp_err_t pcap_format_write_header(const char *comment){
+    static const char hardware[] = "ESP32";
+    static const char application[] = "ESP32 Wi-Fi Penetration Tool";
+    static const char interface_name[] = "wifi0";
+    uint8_t shb_options[MAX_OPTIONS_SIZE];
+    uint8_t idb_options[MAX_OPTIONS_SIZE];
+
+    unsigned shb_options_length = 0;
+    if(comment != NULL){
+        shb_options_length = append_option(shb_options, shb_options_length, OPTION_COMMENT, comment, strlen(comment));
+    }
+    shb_options_length = append_option(shb_options, shb_options_length, OPTION_SHB_HARDWARE, hardware, strlen(hardware));
+    shb_options_length = append_option(shb_options, shb_options_length, OPTION_SHB_USER_APPLICATION, application, strlen(application));
+    shb_options_length = end_options(shb_options, shb_options_length);
+    const uint32_t shb_length = sizeof(section_header_block_t) + shb_options_length + sizeof(uint32_t);
+    const section_header_block_t shb = {
+        .header = { BLOCK_TYPE_SECTION_HEADER, shb_length },
+        .byte_order_magic = BYTE_ORDER_MAGIC,
+        .major_version = 1,
+        .minor_version = 0,
+        // section length is not known in advance
+        .section_length = -1
+    };
+
+    unsigned idb_options_length = append_option(idb_options, 0, OPTION_IF_NAME, interface_name, strlen(interface_name));
+    idb_options_length = end_options(idb_options, idb_options_length);
+    const uint32_t idb_length = sizeof(interface_description_block_t) + idb_options_length + sizeof(uint32_t);
+    const interface_description_block_t idb = {
+        .header = { BLOCK_TYPE_INTERFACE_DESCRIPTION, idb_length },
+        .link_type = LINKTYPE_IEEE802_11_RADIOTAP,
+        .reserved = 0,
+        .snap_len = SNAPLEN
+    };
+
+    const pcap_storage_part_t parts[] = {
+        { &shb, sizeof(shb) },
+        { shb_options, shb_options_length },
+        { &shb_length, sizeof(shb_length) },
+        { &idb, sizeof(idb) },
+        { idb_options, idb_options_length },
+        { &idb_length, sizeof(idb_length) }
+    };
+    return pcap_storage_write(parts, sizeof(parts) / sizeof(parts[0]));
+}
+
+/**
+ * @brief Fills radiotap header of the frame
+ * 
+ * @param radiotap output header
+ * @param rx_ctrl can be \c NULL
+ */
+static void fill_radiotap_header(radiotap_header_t *radiotap, const wifi_pkt_rx_ctrl_t *rx_ctrl){
+    *radiotap = radiotap_template;
+    if(rx_ctrl == NULL){
+        radiotap->length = RADIOTAP_LENGTH_NO_METADATA;
+        radiotap->present = 0;
+        return;
+    }
+    // TSFT is raw time of radio, timestamp of the block is the one from capture clock
+    radiotap->tsft = rx_ctrl->timestamp;
+    unsigned channel = rx_ctrl->channel;
+    radiotap->channel_frequency = (channel == 14) ? 2484 : 2407 + 5 * channel;
+    radiotap->antenna_signal = rx_ctrl->rssi;
+    radiotap->antenna_noise = rx_ctrl->noise_floor;
+    radiotap->antenna = rx_ctrl->ant;
+    if(rx_ctrl->sig_mode == SIG_MODE_NON_HT){
+        radiotap->rate = (rx_ctrl->rate < sizeof(legacy_rates)) ? legacy_rates[rx_ctrl->rate] : 0;
+        // rate indexes up to 11 Mbps (short preamble included) are DSSS/CCK
+        if(rx_ctrl->rate < 8){
+            radiotap->channel_flags |= RADIOTAP_CHANNEL_CCK;
+            if(rx_ctrl->rate >= 5){
+                radiotap->flags |= RADIOTAP_FLAGS_SHORT_PREAMBLE;
+            }
+        }
+        else {
+            radiotap->channel_flags |= RADIOTAP_CHANNEL_OFDM;
+        }
+        return;
+    }
+    radiotap->length = RADIOTAP_LENGTH_HT;
+    radiotap->present = RADIOTAP_PRESENT_COMMON | RADIOTAP_PRESENT_MCS;
+    radiotap->rate = 0;
+    radiotap->channel_flags |= RADIOTAP_CHANNEL_OFDM;
+    radiotap->mcs_known = RADIOTAP_MCS_KNOWN_BANDWIDTH | RADIOTAP_MCS_KNOWN_INDEX | RADIOTAP_MCS_KNOWN_GUARD_INTERVAL 
+                        | RADIOTAP_MCS_KNOWN_FEC | RADIOTAP_MCS_KNOWN_STBC;
+    radiotap->mcs_flags = (rx_ctrl->cwb ? RADIOTAP_MCS_FLAGS_BANDWIDTH_40 : 0)
+                        | (rx_ctrl->sgi ? RADIOTAP_MCS_FLAGS_SHORT_GI : 0)
+                        | (rx_ctrl->fec_coding ? RADIOTAP_MCS_FLAGS_FEC_LDPC : 0)
+                        | (rx_ctrl->stbc << RADIOTAP_MCS_FLAGS_STBC_SHIFT);
+    radiotap->mcs_index = rx_ctrl->mcs;
+}
+
+/**
+ * @brief Headers and trailer of single Enhanced Packet Block, frame data are written from the frame itself
+ */
+typedef struct {
+    enhanced_packet_block_t epb;
+    radiotap_header_t radiotap;
+    uint32_t trailer[2];
+} epb_record_t;
+
+/**
+ * @brief Fills record headers of the frame and its storage parts
+ * 
+ * @param record output headers
+ * @param frame 
+ * @param parts output 4 storage parts of the block
+ * @return unsigned length of the block
+ */
+static unsigned fill_record(epb_record_t *record, const pcap_serializer_frame_t *frame, pcap_storage_part_t *parts){
+    radiotap_header_t *radiotap = &record->radiotap;
+    fill_radiotap_header(radiotap, frame->rx_ctrl);
+
+    unsigned size = frame->size;
+    unsigned original_length = radiotap->length + size;
+    // Stored packet/frame cannot be larger than SNAPLEN
+    if(original_length > SNAPLEN){
+        size = SNAPLEN - radiotap->length;
+    }
+    unsigned captured_length = radiotap->length + size;
+    unsigned padding = (4 - captured_length % 4) % 4;
+    // padding of packet data is taken from zeros in front of trailing block length
+    const uint32_t block_length = sizeof(enhanced_packet_block_t) + captured_length + padding + sizeof(uint32_t);
+    record->trailer[0] = 0;
+    record->trailer[1] = block_length;
+    record->epb = (enhanced_packet_block_t) {
+        .header = { BLOCK_TYPE_ENHANCED_PACKET, block_length },
+        .interface_id = 0,
+        .timestamp_high = frame->ts_usec >> 32,
+        .timestamp_low = (uint32_t) frame->ts_usec,
+        .captured_length = captured_length,
+        .original_length = original_length
+    };
+
+    parts[0] = (pcap_storage_part_t) { &record->epb, sizeof(enhanced_packet_block_t) };
+    parts[1] = (pcap_storage_part_t) { radiotap, radiotap->length };
+    parts[2] = (pcap_storage_part_t) { frame->buffer, size };
+    parts[3] = (pcap_storage_part_t) { (const uint8_t *) record->trailer + sizeof(uint32_t) - padding, padding + sizeof(uint32_t) };
+    return block_length;
+}
+
+esp_err_t pcap_format_write_records(const pcap_serializer_frame_t *frames, unsigned count, unsigned *written){
+    epb_record_t records[PCAP_FORMAT_MAX_RECORDS];
+    pcap_storage_part_t parts[4 * PCAP_FORMAT_MAX_RECORDS];
+    *written = 0;
+    for(unsigned i = 0; i < count; i++){
+        *written += fill_record(&records[i], &frames[i], &parts[4 * i]);
+    }
+    // Whole blocks are written at once, so record is never stored partially
+    return pcap_storage_write(parts, 4 * count);
+}
+
+#endif
@@ -5,97 +5,144 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Implementation of PCAP serializer
+ * 
+ * Records are formatted by file format (see pcap_format.h), storing of resulting binary is done by storage backend (see pcap_storage.h).
  */
 #include "pcap_serializer.h"
+#include "pcap_format.h"
+#include "pcap_storage.h"
 
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_PCAP_SERIALIZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 
+#include "metrics.h"
+
 static const char *TAG = "pcap_serializer";
 
 
+static unsigned dropped_frames = 0;
+static bool initialised = false;
+static atomic_uint generation = 0;
+
+esp_err_t pcap_serializer_init(const char *comment){
+    // Make sure memory from previous attack is freed
+    pcap_serializer_deinit();
+    esp_err_t err = pcap_storage_init();
+    if(err != ESP_OK){
+        return err;
+    }
+    if((err = pcap_format_write_header(comment)) != ESP_OK){
+        return err;
+    }
+    initialised = true;
+    return ESP_OK;
+}
+
 /**
- * @brief Constanst according to reference
+ * @brief Counts frame that failed to be stored
  * 
- * @see Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
+ * @param err 
  */
-//@{
-#define SNAPLEN 65535
-#define PCAP_MAGIC_NUMBER 0xa1b2c3d4
-//@}
+static void drop_frame(esp_err_t err){
+    metrics_counter_inc(METRICS_PCAP_DROPPED);
+    if(dropped_frames++ == 0){
+        ESP_LOGW(TAG, "Error storing PCAP record (0x%x). PCAP buffer may not be complete.", err);
+    }
+}
 
 /**
- * @brief Constanst according to reference
+ * @brief Formats PCAP records of the frames and writes them to storage at once.
+ * 
+ * If the records can't be written together, they are retried one by one.
  * 
- * @see Ref: http://www.tcpdump.org/linktypes.html (LINKTYPE_IEEE802_11)
+ * @param frames non-empty frames
+ * @param count at most PCAP_FORMAT_MAX_RECORDS
  */
-#define LINKTYPE_IEEE802_11 105
-
-static unsigned pcap_size = 0;
-static uint8_t *pcap_buffer = NULL;
-
-uint8_t *pcap_serializer_init(){
-    // Make sure memory from previous attack is freed
-    free(pcap_buffer);
-    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
-    pcap_global_header_t pcap_global_header = {
-        .magic_number = PCAP_MAGIC_NUMBER,
-        .version_major = 2,
-        .version_minor = 4,
-        .thiszone = 0,
-        .sigfigs = 0,
-        .snaplen = SNAPLEN,
-        .network = LINKTYPE_IEEE802_11
-    };
-    pcap_buffer = (uint8_t *)malloc(sizeof(pcap_global_header_t));
-    pcap_size = sizeof(pcap_global_header_t);
-    memcpy(pcap_buffer, &pcap_global_header, sizeof(pcap_global_header_t));
-    return pcap_buffer;
-}
-
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec){
-    if(size == 0){
-        ESP_LOGD(TAG, "Frame size is 0. Not appending anything.");
+static void write_records(const pcap_serializer_frame_t *frames, unsigned count){
+    unsigned written;
+    esp_err_t err = pcap_format_write_records(frames, count, &written);
+    if(err == ESP_OK){
+        metrics_counter_add(METRICS_PCAP_FRAMES, count);
+        metrics_counter_add(METRICS_PCAP_BYTES, written);
         return;
     }
-    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#record-packet-header
-    pcap_record_header_t pcap_record_header = {
-        .ts_sec = ts_usec / 1000000,
-        .ts_usec = ts_usec % 1000000,
-        .incl_len = size,
-        .orig_len = size,
-    };
-    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#record-packet-header
-    // Stored packet/frame cannot be larger than SNAPLEN
-    if(size > SNAPLEN){
-        size = SNAPLEN;
-        pcap_record_header.incl_len = SNAPLEN;
+    if(count == 1){
+        drop_frame(err);
+        return;
     }
+    for(unsigned i = 0; i < count; i++){
+        write_records(&frames[i], 1);
+    }
+}
 
-    uint8_t *reallocated_pcap_buffer = realloc(pcap_buffer, pcap_size + sizeof(pcap_record_header_t) + size);
-    if(reallocated_pcap_buffer == NULL){
-        ESP_LOGE(TAG, "Error reallocating PCAP buffer! PCAP buffer may not be complete.");
+/**
+ * @brief Writes non-empty frames in batches of PCAP_FORMAT_MAX_RECORDS
+ * 
+ * @param frames 
+ * @param count 
+ */
+static void append_frames(const pcap_serializer_frame_t *frames, unsigned count){
+    if(!initialised){
+        ESP_LOGE(TAG, "PCAP serializer is not initialised!");
         return;
     }
-    memcpy(&reallocated_pcap_buffer[pcap_size], &pcap_record_header, sizeof(pcap_record_header_t));
-    memcpy(&reallocated_pcap_buffer[pcap_size + sizeof(pcap_record_header_t)], buffer, size);
-    pcap_buffer = reallocated_pcap_buffer;
-    pcap_size += sizeof(pcap_record_header_t) + size;
+    pcap_serializer_frame_t batch[PCAP_FORMAT_MAX_RECORDS];
+    unsigned batch_count = 0;
+    for(unsigned i = 0; i < count; i++){
+        if(frames[i].size == 0){
+            ESP_LOGD(TAG, "Frame size is 0. Not appending anything.");
+            continue;
+        }
+        batch[batch_count++] = frames[i];
+        if(batch_count == PCAP_FORMAT_MAX_RECORDS){
+            write_records(batch, batch_count);
+            batch_count = 0;
+        }
+    }
+    if(batch_count > 0){
+        write_records(batch, batch_count);
+    }
+}
+
+void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, uint64_t ts_usec, const wifi_pkt_rx_ctrl_t *rx_ctrl){
+    const pcap_serializer_frame_t frame = { .buffer = buffer, .size = size, .ts_usec = ts_usec, .rx_ctrl = rx_ctrl };
+    uint32_t start = metrics_histogram_start();
+    append_frames(&frame, 1);
+    metrics_histogram_observe(METRICS_HISTOGRAM_PCAP_APPEND_FRAME, start);
+}
+
+void pcap_serializer_append_frames(const pcap_serializer_frame_t *frames, unsigned count){
+    uint32_t start = metrics_histogram_start();
+    append_frames(frames, count);
+    metrics_histogram_observe(METRICS_HISTOGRAM_PCAP_APPEND_FRAME, start);
 }
 
 void pcap_serializer_deinit(){
-    free(pcap_buffer);
-    pcap_buffer = NULL;
-    pcap_size = 0;
+    // increased first, so reader that copied data of next capture sees new generation
+    atomic_fetch_add(&generation, 1);
+    pcap_storage_deinit();
+    initialised = false;
+    dropped_frames = 0;
 }
 
 unsigned pcap_serializer_get_size(){
-    return pcap_size;
+    return pcap_storage_get_size();
+}
+
+unsigned pcap_serializer_get_dropped_count(){
+    return dropped_frames;
+}
+
+unsigned pcap_serializer_get_generation(){
+    return atomic_load(&generation);
 }
 
-uint8_t *pcap_serializer_get_buffer(){
-    return pcap_buffer;
-}
\ No newline at end of file
+unsigned pcap_serializer_read(unsigned offset, uint8_t *buffer, unsigned size){
+    return pcap_storage_read(offset, buffer, size);
+}
@@ -0,0 +1,66 @@
+/**
+ * @file pcap_storage.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Provides internal interface of PCAP storage backends.
+ * 
+ * PCAP serializer formats records and storage backend keeps the resulting binary.
+ * Backend is chosen at compile time by CONFIG_PCAP_SERIALIZER_STORAGE_* option.
+ */
+#ifndef PCAP_STORAGE_H
+#define PCAP_STORAGE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief Part of data that should be appended to storage
+ */
+typedef struct {
+    const void *data;
+    unsigned size;
+} pcap_storage_part_t;
+
+/**
+ * @brief Prepares empty storage. Any previously stored data are discarded.
+ * 
+ * @return ESP_OK on success
+ */
+esp_err_t pcap_storage_init();
+
+/**
+ * @brief Frees all resources held by storage.
+ */
+void pcap_storage_deinit();
+
+/**
+ * @brief Appends all given parts at the end of storage.
+ * 
+ * Parts are either appended all or none of them, so single record is never stored partially.
+ * 
+ * @param parts array of data parts
+ * @param count number of parts
+ * @return ESP_OK if data were appended
+ * @return ESP_ERR_INVALID_SIZE if data don't fit into storage capacity
+ * @return other error if storage failed
+ */
+esp_err_t pcap_storage_write(const pcap_storage_part_t *parts, unsigned count);
+
+/**
+ * @brief Returns number of stored bytes
+ * 
+ * @return unsigned 
+ */
+unsigned pcap_storage_get_size();
+
+/**
+ * @brief Copies stored data starting at given offset into caller's buffer.
+ * 
+ * Data are copied with storage lock held, so storage can be written or reinitialised right after it returns.
+ * 
+ * @see pcap_serializer_read()
+ */
+unsigned pcap_storage_read(unsigned offset, uint8_t *buffer, unsigned size);
+
+#endif
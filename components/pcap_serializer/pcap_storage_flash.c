@@ -0,0 +1,225 @@
+/**
+ * @file pcap_storage_flash.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements PCAP storage spooled to flash partition.
+ * 
+ * Data are appended into write-behind buffer of one flash page. Only whole pages are erased and written,
+ * so capture size is limited by partition size instead of free heap.
+ * Reads copy flushed pages straight from partition and the last, not yet flushed page from write-behind buffer.
+ * Failed write is rolled back to the state before it, so records are stored either whole or not at all.
+ */
+#include "pcap_storage.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+#include "alloc_policy.h"
+
+#if CONFIG_PCAP_SERIALIZER_STORAGE_FLASH
+
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+/**
+ * @brief Flash sector size - smallest erasable unit
+ */
+#define PAGE_SIZE 4096
+
+static const char *TAG = "pcap_serializer:flash";
+
+static const esp_partition_t *partition = NULL;
+/**
+ * @brief Protects buffers, as data can be written by capture and read by webserver at the same time.
+ */
+static SemaphoreHandle_t lock = NULL;
+static uint8_t *write_buffer = NULL;
+static unsigned flushed_size = 0;
+static unsigned buffered_size = 0;
+/**
+ * @brief Set when failed write couldn't be rolled back, no more data are accepted
+ */
+static bool broken = false;
+
+/**
+ * @brief Erases next page in partition and writes whole write-behind buffer into it.
+ * 
+ * @return esp_err_t 
+ */
+static esp_err_t flush_page(){
+    esp_err_t err = esp_partition_erase_range(partition, flushed_size, PAGE_SIZE);
+    if(err == ESP_OK){
+        err = esp_partition_write(partition, flushed_size, write_buffer, PAGE_SIZE);
+    }
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Writing page at offset %u failed (0x%x)", flushed_size, err);
+        return err;
+    }
+    flushed_size += PAGE_SIZE;
+    buffered_size = 0;
+    return ESP_OK;
+}
+
+esp_err_t pcap_storage_init(){
+    if(partition == NULL){
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, CONFIG_PCAP_SERIALIZER_PARTITION_LABEL);
+        if(partition == NULL){
+            ESP_LOGE(TAG, "Partition '%s' not found!", CONFIG_PCAP_SERIALIZER_PARTITION_LABEL);
+            return ESP_ERR_NOT_FOUND;
+        }
+        ESP_LOGI(TAG, "Spooling PCAP to partition '%s' (%u B)", partition->label, (unsigned) partition->size);
+    }
+    if(lock == NULL){
+        lock = xSemaphoreCreateMutex();
+        if(lock == NULL){
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    pcap_storage_deinit();
+    uint8_t *new_write_buffer = (uint8_t *) alloc_policy_malloc(ALLOC_POLICY_SUBSYSTEM_PCAP, PAGE_SIZE);
+    if(new_write_buffer == NULL){
+        return ESP_ERR_NO_MEM;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    write_buffer = new_write_buffer;
+    xSemaphoreGive(lock);
+    return ESP_OK;
+}
+
+void pcap_storage_deinit(){
+    if(lock == NULL){
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    free(write_buffer);
+    write_buffer = NULL;
+    flushed_size = 0;
+    buffered_size = 0;
+    broken = false;
+    xSemaphoreGive(lock);
+}
+
+/**
+ * @brief Copies data into write-behind buffer and flushes every filled page.
+ * 
+ * @param data 
+ * @param size 
+ * @return esp_err_t 
+ */
+static esp_err_t buffer_data(const void *data, unsigned size){
+    const uint8_t *source = (const uint8_t *) data;
+    unsigned written = 0;
+    while(written < size){
+        unsigned length = PAGE_SIZE - buffered_size;
+        if(length > size - written){
+            length = size - written;
+        }
+        memcpy(&write_buffer[buffered_size], &source[written], length);
+        buffered_size += length;
+        written += length;
+        if(buffered_size == PAGE_SIZE){
+            esp_err_t err = flush_page();
+            if(err != ESP_OK){
+                return err;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Returns storage into state before failed write.
+ * 
+ * Data buffered before the write are still at the beginning of write-behind buffer, unless the write flushed some pages.
+ * Then they are read back from the first of those pages. Pages flushed by failed write are beyond stored size,
+ * so they are overwritten by next flush.
+ * 
+ * @param saved_flushed_size flushed size before the write
+ * @param saved_buffered_size buffered size before the write
+ */
+static void rollback(unsigned saved_flushed_size, unsigned saved_buffered_size){
+    if(flushed_size != saved_flushed_size){
+        flushed_size = saved_flushed_size;
+        if((saved_buffered_size > 0) && (esp_partition_read(partition, saved_flushed_size, write_buffer, saved_buffered_size) != ESP_OK)){
+            // buffered data are lost, the rest of capture stays readable
+            ESP_LOGE(TAG, "Rollback of page at offset %u failed, no more data will be stored", saved_flushed_size);
+            buffered_size = 0;
+            broken = true;
+            return;
+        }
+    }
+    buffered_size = saved_buffered_size;
+}
+
+esp_err_t pcap_storage_write(const pcap_storage_part_t *parts, unsigned count){
+    if(lock == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    unsigned size = 0;
+    for(unsigned i = 0; i < count; i++){
+        size += parts[i].size;
+    }
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if((write_buffer == NULL) || broken){
+        err = ESP_ERR_INVALID_STATE;
+    }
+    // Only whole pages are written, so the last partial page has to fit as well
+    else if(((flushed_size + buffered_size + size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1)) > partition->size){
+        err = ESP_ERR_INVALID_SIZE;
+    }
+    const unsigned saved_flushed_size = flushed_size;
+    const unsigned saved_buffered_size = buffered_size;
+    for(unsigned i = 0; (i < count) && (err == ESP_OK); i++){
+        err = buffer_data(parts[i].data, parts[i].size);
+    }
+    if((err != ESP_OK) && (write_buffer != NULL)){
+        rollback(saved_flushed_size, saved_buffered_size);
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+unsigned pcap_storage_get_size(){
+    if(lock == NULL){
+        return 0;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    unsigned size = flushed_size + buffered_size;
+    xSemaphoreGive(lock);
+    return size;
+}
+
+unsigned pcap_storage_read(unsigned offset, uint8_t *buffer, unsigned size){
+    if(lock == NULL){
+        return 0;
+    }
+    unsigned length = 0;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if((write_buffer != NULL) && (offset < flushed_size + buffered_size)){
+        if(size > flushed_size + buffered_size - offset){
+            size = flushed_size + buffered_size - offset;
+        }
+        if(offset < flushed_size){
+            length = (size < flushed_size - offset) ? size : flushed_size - offset;
+            esp_err_t err = esp_partition_read(partition, offset, buffer, length);
+            if(err != ESP_OK){
+                ESP_LOGE(TAG, "Reading %u B at offset %u failed (0x%x)", length, offset, err);
+                xSemaphoreGive(lock);
+                return 0;
+            }
+        }
+        // Not flushed yet, copy it from write-behind buffer
+        memcpy(&buffer[length], &write_buffer[offset + length - flushed_size], size - length);
+        length = size;
+    }
+    xSemaphoreGive(lock);
+    return length;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,149 @@
+/**
+ * @file pcap_storage_ram.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ * 
+ * @brief Implements PCAP storage in RAM.
+ * 
+ * PCAP binary is stored in list of fixed size chunks allocated on demand. 
+ * Appending data never moves already stored data, so capture grows in O(n) and doesn't need one big contiguous block of heap.
+ */
+#include "pcap_storage.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+#include "alloc_policy.h"
+
+#if CONFIG_PCAP_SERIALIZER_STORAGE_RAM
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+/**
+ * @brief Maximum number of chunks given by configured ceiling
+ */
+#define MAX_CHUNKS ((CONFIG_PCAP_SERIALIZER_MAX_SIZE + CONFIG_PCAP_SERIALIZER_CHUNK_SIZE - 1) / CONFIG_PCAP_SERIALIZER_CHUNK_SIZE)
+
+/**
+ * @brief Protects chunks and size, as data can be written by capture and read by webserver at the same time.
+ */
+static SemaphoreHandle_t lock = NULL;
+static unsigned storage_size = 0;
+static unsigned chunk_count = 0;
+static uint8_t *chunks[MAX_CHUNKS] = { NULL };
+
+esp_err_t pcap_storage_init(){
+    if(lock == NULL){
+        lock = xSemaphoreCreateMutex();
+        if(lock == NULL){
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    pcap_storage_deinit();
+    return ESP_OK;
+}
+
+void pcap_storage_deinit(){
+    if(lock == NULL){
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for(unsigned i = 0; i < chunk_count; i++){
+        free(chunks[i]);
+        chunks[i] = NULL;
+    }
+    chunk_count = 0;
+    storage_size = 0;
+    xSemaphoreGive(lock);
+}
+
+/**
+ * @brief Copies data at the end of storage. Chunks have to be already allocated.
+ * 
+ * @param data 
+ * @param size 
+ */
+static void copy_data(const void *data, unsigned size){
+    const uint8_t *source = (const uint8_t *) data;
+    unsigned written = 0;
+    while(written < size){
+        unsigned chunk_index = storage_size / CONFIG_PCAP_SERIALIZER_CHUNK_SIZE;
+        unsigned chunk_offset = storage_size % CONFIG_PCAP_SERIALIZER_CHUNK_SIZE;
+        unsigned length = CONFIG_PCAP_SERIALIZER_CHUNK_SIZE - chunk_offset;
+        if(length > size - written){
+            length = size - written;
+        }
+        memcpy(&chunks[chunk_index][chunk_offset], &source[written], length);
+        written += length;
+        storage_size += length;
+    }
+}
+
+esp_err_t pcap_storage_write(const pcap_storage_part_t *parts, unsigned count){
+    if(lock == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    unsigned size = 0;
+    for(unsigned i = 0; i < count; i++){
+        size += parts[i].size;
+    }
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if(storage_size + size > CONFIG_PCAP_SERIALIZER_MAX_SIZE){
+        err = ESP_ERR_INVALID_SIZE;
+    }
+    // Allocate all needed chunks first, so data are never written partially
+    unsigned needed_chunks = (storage_size + size + CONFIG_PCAP_SERIALIZER_CHUNK_SIZE - 1) / CONFIG_PCAP_SERIALIZER_CHUNK_SIZE;
+    while((err == ESP_OK) && (chunk_count < needed_chunks)){
+        chunks[chunk_count] = (uint8_t *) alloc_policy_malloc(ALLOC_POLICY_SUBSYSTEM_PCAP, CONFIG_PCAP_SERIALIZER_CHUNK_SIZE);
+        if(chunks[chunk_count] == NULL){
+            err = ESP_ERR_NO_MEM;
+            break;
+        }
+        chunk_count++;
+    }
+    for(unsigned i = 0; (err == ESP_OK) && (i < count); i++){
+        copy_data(parts[i].data, parts[i].size);
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+unsigned pcap_storage_get_size(){
+    if(lock == NULL){
+        return 0;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    unsigned size = storage_size;
+    xSemaphoreGive(lock);
+    return size;
+}
+
+unsigned pcap_storage_read(unsigned offset, uint8_t *buffer, unsigned size){
+    if(lock == NULL){
+        return 0;
+    }
+    unsigned length = 0;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if(offset < storage_size){
+        if(size > storage_size - offset){
+            size = storage_size - offset;
+        }
+        while(length < size){
+            unsigned chunk_offset = (offset + length) % CONFIG_PCAP_SERIALIZER_CHUNK_SIZE;
+            unsigned part = CONFIG_PCAP_SERIALIZER_CHUNK_SIZE - chunk_offset;
+            if(part > size - length){
+                part = size - length;
+            }
+            memcpy(&buffer[length], &chunks[(offset + length) / CONFIG_PCAP_SERIALIZER_CHUNK_SIZE][chunk_offset], part);
+            length += part;
+        }
+    }
+    xSemaphoreGive(lock);
+    return length;
+}
+
+#endif
@@ -3,289 +3,291 @@
 
 // This file was generated using xxd
 unsigned char page_index[] = {
-  0X1F, 0X8B, 0X08, 0X08, 0X17, 0X11, 0X2B, 0X61, 0X02, 0X03, 0X69, 0X6E,
+  0X1F, 0X8B, 0X08, 0X08, 0X11, 0XA0, 0XD3, 0X6A, 0X02, 0X03, 0X69, 0X6E,
   0X64, 0X65, 0X78, 0X2E, 0X68, 0X74, 0X6D, 0X6C, 0X00, 0XC5, 0X1B, 0X6B,
-  0X53, 0XE3, 0XB6, 0XF6, 0X7B, 0X7F, 0X85, 0XEA, 0X3B, 0X77, 0XEA, 0X14,
-  0XE2, 0X24, 0XEC, 0X2E, 0XD3, 0X86, 0X24, 0X33, 0X21, 0XA4, 0X85, 0X59,
-  0X08, 0X0C, 0X09, 0X6D, 0X77, 0XF6, 0XEE, 0X64, 0X9C, 0X58, 0XC1, 0X2E,
-  0X8E, 0XED, 0XDA, 0X32, 0X90, 0XBB, 0XC3, 0X7F, 0XBF, 0X47, 0X92, 0X1F,
-  0X92, 0X2D, 0X07, 0X87, 0X85, 0XBD, 0X3B, 0XD3, 0X12, 0X4B, 0X47, 0XE7,
-  0XA5, 0XA3, 0XF3, 0X92, 0XDD, 0XFB, 0XF1, 0XE4, 0X72, 0X34, 0XFB, 0X74,
-  0X35, 0X46, 0X36, 0X59, 0XBB, 0X83, 0X1F, 0X7A, 0XE9, 0X1F, 0X6C, 0X5A,
-  0X83, 0X1F, 0X10, 0XFC, 0XEB, 0XAD, 0X31, 0X31, 0X91, 0X67, 0XAE, 0X71,
-  0X5F, 0XBB, 0X77, 0XF0, 0X43, 0XE0, 0X87, 0X44, 0X43, 0X4B, 0XDF, 0X23,
-  0XD8, 0X23, 0X7D, 0XED, 0XC1, 0XB1, 0X88, 0XDD, 0XB7, 0XF0, 0XBD, 0XB3,
-  0XC4, 0X4D, 0XF6, 0XB0, 0XEF, 0X78, 0X0E, 0X71, 0X4C, 0XB7, 0X19, 0X2D,
-  0X4D, 0X17, 0XF7, 0X3B, 0X5A, 0X82, 0X87, 0X38, 0XC4, 0XC5, 0X83, 0XF1,
-  0XF4, 0XEA, 0XDD, 0X01, 0XBA, 0X30, 0X3D, 0XF3, 0X16, 0XAF, 0X01, 0X03,
-  0X1A, 0X5E, 0XF5, 0X5A, 0X7C, 0X8A, 0X83, 0X45, 0X64, 0X93, 0XFE, 0XA6,
-  0XFF, 0X16, 0XBE, 0XB5, 0X41, 0X5F, 0XB3, 0X47, 0XFA, 0X8F, 0X51, 0XE9,
-  0XA2, 0X95, 0X43, 0X9A, 0X09, 0X1B, 0X47, 0XD9, 0XFC, 0X53, 0XF6, 0X8B,
-  0X98, 0X0B, 0X17, 0XEF, 0X23, 0X12, 0XC2, 0X7F, 0X76, 0X01, 0XC3, 0XC2,
-  0X0F, 0X2D, 0X1C, 0X76, 0X51, 0X27, 0X78, 0X44, 0X91, 0XEF, 0X3A, 0XD6,
-  0X91, 0X62, 0X1A, 0X90, 0XBB, 0XAE, 0X19, 0X44, 0XB8, 0X8B, 0XD2, 0X5F,
-  0X32, 0X18, 0XC1, 0X8F, 0XA4, 0X69, 0XBA, 0XCE, 0XAD, 0X07, 0X10, 0XC0,
-  0X05, 0X0E, 0X95, 0X7C, 0XD8, 0XC0, 0X80, 0X55, 0X60, 0X20, 0X30, 0X2D,
-  0XCB, 0XF1, 0X6E, 0XBB, 0X9D, 0X76, 0XF0, 0XA8, 0X5C, 0X14, 0X76, 0X6D,
-  0XFF, 0X1E, 0X53, 0XDE, 0X43, 0X23, 0XC2, 0X2E, 0X5E, 0X12, 0X5C, 0XC4,
-  0XB1, 0X30, 0X97, 0X77, 0XB7, 0XA1, 0X1F, 0X7B, 0X16, 0XE5, 0XD4, 0X07,
-  0X71, 0X80, 0X15, 0X9B, 0X2C, 0XDC, 0XB8, 0XC0, 0XE7, 0X32, 0X0E, 0X23,
-  0X98, 0X0E, 0X7C, 0X47, 0XC5, 0X63, 0XAF, 0X95, 0X68, 0XBC, 0XD7, 0XE2,
-  0X9B, 0XDE, 0X63, 0X2A, 0XF7, 0XBD, 0X73, 0XDF, 0XB4, 0XFA, 0XDA, 0X2D,
-  0X26, 0X53, 0X62, 0X92, 0X38, 0XD2, 0X1B, 0XE9, 0X46, 0XDA, 0X9D, 0X64,
-  0X17, 0XFF, 0X74, 0X9A, 0XBF, 0X39, 0XE8, 0X0A, 0X7B, 0X98, 0X84, 0X26,
-  0X71, 0X7C, 0X0F, 0XCD, 0X7C, 0XDF, 0X05, 0X3C, 0X9D, 0X74, 0X2F, 0X81,
-  0X6F, 0X3A, 0XEC, 0X00, 0X22, 0X1C, 0X86, 0X7E, 0X18, 0X69, 0X03, 0XA0,
-  0XC7, 0X47, 0X15, 0X30, 0X2E, 0X90, 0X04, 0XB5, 0X68, 0X83, 0X73, 0XFE,
-  0XC3, 0X30, 0X0C, 0X74, 0XE5, 0X62, 0X33, 0XC2, 0XE8, 0XC1, 0X74, 0XC8,
-  0XB6, 0XA5, 0X21, 0XF0, 0XBE, 0XD1, 0X10, 0X93, 0XA5, 0XAF, 0X59, 0X4E,
-  0X14, 0XB8, 0XE6, 0XA6, 0X8B, 0X3C, 0XDF, 0XC3, 0X47, 0X5A, 0X6E, 0X4E,
-  0X3D, 0XFB, 0X60, 0X30, 0X24, 0X04, 0X54, 0X47, 0X4D, 0X78, 0XE5, 0XDC,
-  0XC6, 0X9C, 0X73, 0X60, 0XFA, 0X40, 0X80, 0X5A, 0XF9, 0XE1, 0X1A, 0X54,
-  0X30, 0X8D, 0X17, 0X6B, 0X07, 0X8C, 0X3C, 0X8C, 0X3D, 0XBE, 0X48, 0X6F,
-  0X1C, 0XA1, 0X10, 0X93, 0X38, 0XF4, 0XD0, 0XCA, 0X74, 0X23, 0X09, 0X35,
-  0X5F, 0XE8, 0X60, 0XD7, 0X8A, 0X30, 0X91, 0X87, 0XD9, 0X94, 0X8B, 0X6F,
-  0XB1, 0X67, 0X0D, 0XA6, 0X6C, 0X37, 0XC1, 0X3C, 0X43, 0X50, 0X6D, 0XAF,
-  0X95, 0X8C, 0X96, 0XC1, 0X99, 0XFD, 0X32, 0XD1, 0XCC, 0XA0, 0XE9, 0X3A,
-  0X11, 0XA1, 0XAA, 0X63, 0X83, 0X0A, 0XE0, 0XA0, 0X3C, 0XC6, 0XC6, 0X17,
-  0X31, 0X21, 0XA0, 0X20, 0XB2, 0X09, 0X40, 0X29, 0XFC, 0X41, 0X03, 0XB9,
-  0X46, 0XAE, 0XB3, 0XBC, 0XA3, 0X3A, 0X5B, 0X85, 0X38, 0XB2, 0X87, 0X01,
-  0XDB, 0XDC, 0X6B, 0XFE, 0XD4, 0X6B, 0X71, 0X38, 0X05, 0X95, 0X56, 0X81,
-  0X4C, 0XAF, 0XA5, 0X16, 0XB7, 0X86, 0X16, 0XD4, 0X7B, 0X50, 0XA9, 0X8C,
-  0X2A, 0XF9, 0X5C, 0X73, 0X81, 0X5D, 0X04, 0XBB, 0X05, 0X5A, 0X62, 0X18,
-  0XE7, 0X54, 0X54, 0X2D, 0X45, 0X4F, 0X1F, 0XBA, 0X80, 0X96, 0X42, 0X55,
-  0X60, 0XE0, 0X87, 0X8B, 0XEB, 0X59, 0XC0, 0X40, 0X95, 0X64, 0X9B, 0XDE,
-  0X2D, 0XA8, 0X2D, 0X0E, 0X2C, 0X93, 0XE0, 0X51, 0XCA, 0X29, 0X6C, 0XC0,
-  0X6F, 0X4C, 0X3C, 0X9D, 0XD8, 0X4E, 0XD4, 0XD0, 0XC0, 0X1E, 0XFE, 0X89,
-  0X9D, 0X10, 0X5B, 0X6A, 0X02, 0X8C, 0X88, 0X1F, 0X30, 0X3B, 0XBD, 0X37,
-  0XE1, 0X6C, 0XF6, 0XB5, 0XB6, 0X86, 0X98, 0XC3, 0XEB, 0X6B, 0X33, 0XC0,
+  0X73, 0XDA, 0XB8, 0XF6, 0XFB, 0XFE, 0X0A, 0XD5, 0X77, 0XEE, 0XAC, 0XD9,
+  0X04, 0X03, 0X69, 0X9B, 0XD9, 0X12, 0X60, 0X86, 0X10, 0XBA, 0XC9, 0X34,
+  0X81, 0X0C, 0X90, 0XDD, 0XED, 0XF4, 0X76, 0X18, 0X83, 0X45, 0XEC, 0XC6,
+  0XD8, 0X5E, 0X5B, 0XCE, 0XE3, 0X76, 0XF2, 0XDF, 0XEF, 0X91, 0XE4, 0X87,
+  0X64, 0X64, 0X62, 0XD2, 0XA4, 0XB7, 0X33, 0XBB, 0XC1, 0XD2, 0XD1, 0X79,
+  0XE9, 0XE8, 0XBC, 0X64, 0X77, 0XDE, 0X9C, 0X8C, 0X07, 0XB3, 0XCF, 0X97,
+  0X43, 0X64, 0X93, 0XB5, 0XDB, 0XFB, 0XA5, 0X93, 0XFE, 0XC1, 0XA6, 0XD5,
+  0XFB, 0X05, 0XC1, 0XBF, 0XCE, 0X1A, 0X13, 0X13, 0X79, 0XE6, 0X1A, 0X77,
+  0XB5, 0X5B, 0X07, 0XDF, 0X05, 0X7E, 0X48, 0X34, 0XB4, 0XF4, 0X3D, 0X82,
+  0X3D, 0XD2, 0XD5, 0XEE, 0X1C, 0X8B, 0XD8, 0X5D, 0X0B, 0XDF, 0X3A, 0X4B,
+  0X5C, 0X67, 0X0F, 0XFB, 0X8E, 0XE7, 0X10, 0XC7, 0X74, 0XEB, 0XD1, 0XD2,
+  0X74, 0X71, 0XB7, 0XA5, 0X25, 0X78, 0X88, 0X43, 0X5C, 0XDC, 0X1B, 0X4E,
+  0X2F, 0XDF, 0X1E, 0XA0, 0X0B, 0XD3, 0X33, 0XAF, 0XF1, 0X1A, 0X30, 0XA0,
+  0XFE, 0X65, 0XA7, 0XC1, 0XA7, 0X38, 0X58, 0X44, 0X1E, 0XD2, 0XDF, 0XF4,
+  0XDF, 0XC2, 0XB7, 0X1E, 0XD0, 0XF7, 0XEC, 0X91, 0XFE, 0X63, 0X54, 0XDA,
+  0X68, 0XE5, 0X90, 0X7A, 0XC2, 0XC6, 0X51, 0X36, 0XFF, 0X98, 0XFD, 0X22,
+  0XE6, 0XC2, 0XC5, 0XFB, 0X88, 0X84, 0XF0, 0X9F, 0X5D, 0XC0, 0XB0, 0XF0,
+  0X43, 0X0B, 0X87, 0X6D, 0XD4, 0X0A, 0XEE, 0X51, 0XE4, 0XBB, 0X8E, 0X75,
+  0XA4, 0X98, 0X06, 0XE4, 0XAE, 0X6B, 0X06, 0X11, 0X6E, 0XA3, 0XF4, 0X97,
+  0X0C, 0X46, 0XF0, 0X3D, 0XA9, 0X9B, 0XAE, 0X73, 0XED, 0X01, 0X04, 0X70,
+  0X81, 0X43, 0X25, 0X1F, 0X36, 0X30, 0X60, 0X15, 0X18, 0X08, 0X4C, 0XCB,
+  0X72, 0XBC, 0XEB, 0X76, 0XAB, 0X19, 0XDC, 0X2B, 0X17, 0X85, 0X6D, 0XDB,
+  0XBF, 0XC5, 0X94, 0XF7, 0XD0, 0X88, 0XB0, 0X8B, 0X97, 0X04, 0X17, 0X71,
+  0X2C, 0XCC, 0XE5, 0XCD, 0X75, 0XE8, 0XC7, 0X9E, 0X45, 0X39, 0XF5, 0X41,
+  0X1C, 0X60, 0XC5, 0X26, 0X0B, 0X37, 0X2E, 0XF0, 0XB9, 0X8C, 0XC3, 0X08,
+  0XA6, 0X03, 0XDF, 0X51, 0XF1, 0XD8, 0X69, 0X24, 0X1A, 0XEF, 0X34, 0XF8,
+  0XA6, 0X77, 0X98, 0XCA, 0X7D, 0XEF, 0XDC, 0X37, 0XAD, 0XAE, 0X76, 0X8D,
+  0XC9, 0X94, 0X98, 0X24, 0X8E, 0XF4, 0X5A, 0XBA, 0X91, 0X76, 0X2B, 0XD9,
+  0XC5, 0XBF, 0X9C, 0XFA, 0X47, 0X07, 0X5D, 0X62, 0X0F, 0X93, 0XD0, 0X24,
+  0X8E, 0XEF, 0XA1, 0X99, 0XEF, 0XBB, 0X80, 0XA7, 0X95, 0XEE, 0X25, 0XF0,
+  0X4D, 0X87, 0X1D, 0X40, 0X84, 0XC3, 0XD0, 0X0F, 0X23, 0XAD, 0X07, 0XF4,
+  0XF8, 0XA8, 0X02, 0XC6, 0X05, 0X92, 0XA0, 0X16, 0XAD, 0X77, 0XCE, 0X7F,
+  0X18, 0X86, 0X81, 0X2E, 0X5D, 0X6C, 0X46, 0X18, 0XDD, 0X99, 0X0E, 0XD9,
+  0XB6, 0X34, 0X04, 0XDE, 0X1F, 0X34, 0XC4, 0X64, 0XE9, 0X6A, 0X96, 0X13,
+  0X05, 0XAE, 0XF9, 0XD0, 0X46, 0X9E, 0XEF, 0XE1, 0X23, 0X2D, 0X37, 0XA7,
+  0X8E, 0X7D, 0XD0, 0XEB, 0X13, 0X02, 0XAA, 0XA3, 0X26, 0XBC, 0X72, 0XAE,
+  0X63, 0XCE, 0X39, 0X30, 0X7D, 0X20, 0X40, 0XAD, 0XFC, 0X70, 0X0D, 0X2A,
+  0X98, 0XC6, 0X8B, 0XB5, 0X03, 0X46, 0X1E, 0XC6, 0X1E, 0X5F, 0XA4, 0XD7,
+  0X8E, 0X50, 0X88, 0X49, 0X1C, 0X7A, 0X68, 0X65, 0XBA, 0X91, 0X84, 0X9A,
+  0X2F, 0X74, 0XB0, 0X6B, 0X45, 0X98, 0XC8, 0XC3, 0X6C, 0XCA, 0XC5, 0XD7,
+  0XD8, 0XB3, 0X7A, 0X53, 0XB6, 0X9B, 0X60, 0X9E, 0X21, 0XA8, 0XB6, 0XD3,
+  0X48, 0X46, 0X37, 0XC1, 0X99, 0XFD, 0X32, 0XD1, 0XCC, 0XA0, 0XEE, 0X3A,
+  0X11, 0XA1, 0XAA, 0X63, 0X83, 0X0A, 0XE0, 0X60, 0X73, 0X8C, 0X8D, 0X2F,
+  0X62, 0X42, 0X40, 0X41, 0XE4, 0X21, 0X00, 0XA5, 0XF0, 0X07, 0X0D, 0XE4,
+  0X1A, 0XB8, 0XCE, 0XF2, 0X86, 0XEA, 0X6C, 0X15, 0XE2, 0XC8, 0XEE, 0X07,
+  0X6C, 0X73, 0X27, 0XFC, 0XA9, 0XD3, 0XE0, 0X70, 0X0A, 0X2A, 0X8D, 0X02,
+  0X99, 0X4E, 0X43, 0X2D, 0X6E, 0X05, 0X2D, 0XA8, 0XF7, 0XA0, 0X54, 0X19,
+  0X65, 0XF2, 0XB9, 0XE6, 0X02, 0XBB, 0X08, 0X76, 0X0B, 0XB4, 0XC4, 0X30,
+  0XCE, 0XA9, 0XA8, 0X5A, 0X8A, 0X9E, 0X3E, 0XB4, 0X01, 0X2D, 0X85, 0X2A,
+  0XC1, 0XC0, 0X0F, 0X17, 0XD7, 0XB3, 0X80, 0X81, 0X2A, 0XC9, 0X36, 0XBD,
+  0X6B, 0X50, 0X5B, 0X1C, 0X58, 0X26, 0XC1, 0X83, 0X94, 0X53, 0XD8, 0X80,
+  0X8F, 0X4C, 0X3C, 0X9D, 0XD8, 0X4E, 0X54, 0XD3, 0XC0, 0X1E, 0XFE, 0X89,
+  0X9D, 0X10, 0X5B, 0X6A, 0X02, 0X8C, 0X88, 0X1F, 0X30, 0X3B, 0XBD, 0X35,
+  0XE1, 0X6C, 0X76, 0XB5, 0XA6, 0X86, 0X98, 0XC3, 0XEB, 0X6A, 0X33, 0XC0,
   0XC0, 0X98, 0X44, 0XF0, 0XD7, 0XF3, 0X81, 0X8D, 0X75, 0XE0, 0X32, 0XB7,
-  0X08, 0XA7, 0X7D, 0X83, 0X89, 0XA1, 0X21, 0XB0, 0X64, 0X4A, 0X12, 0X34,
-  0X36, 0X9B, 0X0D, 0X47, 0X1F, 0XE7, 0XD4, 0X57, 0XCF, 0XAF, 0X86, 0XD3,
-  0XE9, 0XD9, 0X1F, 0XE3, 0X5E, 0X8B, 0X23, 0XAE, 0X4D, 0X19, 0X7C, 0XB1,
-  0X88, 0XE6, 0X74, 0X38, 0X39, 0X99, 0X9E, 0X0E, 0X3F, 0XEE, 0X8E, 0XE8,
-  0X00, 0X4E, 0X5A, 0XE2, 0X95, 0X64, 0XC6, 0X2E, 0X3E, 0X9E, 0X9D, 0XEC,
-  0X8C, 0XED, 0X9D, 0XCC, 0XD6, 0XC9, 0XE5, 0X74, 0X3B, 0X0A, 0XEA, 0X07,
-  0X28, 0XF1, 0X1A, 0X26, 0XBA, 0XA3, 0XF5, 0X40, 0XAC, 0XB3, 0X7D, 0X2B,
+  0X08, 0XA7, 0XFD, 0X01, 0X13, 0X43, 0X43, 0X60, 0XC9, 0X94, 0X24, 0X68,
+  0X6C, 0X36, 0XEB, 0X0F, 0X3E, 0XCD, 0XA9, 0XAF, 0X9E, 0X5F, 0XF6, 0XA7,
+  0XD3, 0XB3, 0X3F, 0X87, 0X9D, 0X06, 0X47, 0X5C, 0X99, 0X32, 0XF8, 0X62,
+  0X11, 0XCD, 0X69, 0X7F, 0X74, 0X32, 0X3D, 0XED, 0X7F, 0XDA, 0X1D, 0XD1,
+  0X01, 0X9C, 0XB4, 0XC4, 0X2B, 0XC9, 0X8C, 0X5D, 0X7C, 0X3A, 0X3B, 0XD9,
+  0X19, 0XDB, 0X5B, 0X99, 0XAD, 0X93, 0XF1, 0X74, 0X3B, 0X0A, 0XEA, 0X07,
+  0X28, 0XF1, 0X0A, 0X26, 0XBA, 0XA3, 0XF5, 0X40, 0XAC, 0XB3, 0X7D, 0X2B,
   0XB3, 0X1F, 0XFE, 0XB8, 0XB3, 0X05, 0X25, 0X58, 0X32, 0XCB, 0XC8, 0X37,
-  0XB1, 0XAE, 0X46, 0X72, 0XF5, 0X66, 0X6B, 0X91, 0XED, 0X58, 0X16, 0XF6,
-  0X06, 0X93, 0XCB, 0X19, 0X1A, 0XFE, 0X31, 0X3C, 0X3B, 0X1F, 0X1E, 0X9F,
-  0X8F, 0XFF, 0X5F, 0X7A, 0X22, 0XCE, 0X1A, 0XFB, 0X31, 0XC9, 0X0F, 0X1A,
-  0X7F, 0X46, 0X3A, 0XB8, 0X64, 0XDF, 0XB3, 0XA2, 0XC6, 0X33, 0X3A, 0X73,
-  0XBC, 0X00, 0XA0, 0XB9, 0X5B, 0XF2, 0XE2, 0XF5, 0X02, 0X87, 0X1A, 0X5A,
-  0X3B, 0X1E, 0X3B, 0X1B, 0X6B, 0XF3, 0X11, 0X0C, 0XEC, 0XC3, 0X07, 0X4D,
-  0X3A, 0X94, 0X09, 0XC1, 0X5C, 0X41, 0XA9, 0X72, 0X5B, 0XDF, 0X2A, 0X5D,
-  0XE2, 0XEE, 0XB8, 0X24, 0XDF, 0XE8, 0XFD, 0X60, 0X0C, 0X22, 0XC7, 0X20,
-  0X0D, 0XAC, 0XD5, 0XD1, 0X2A, 0XF6, 0X3C, 0X1A, 0XE8, 0X9E, 0X8D, 0X57,
-  0X33, 0X90, 0X1B, 0X61, 0X96, 0X7C, 0X58, 0X5D, 0XC0, 0X11, 0X98, 0X12,
-  0X82, 0X66, 0X10, 0XFA, 0XB7, 0XE0, 0XB5, 0X79, 0X5C, 0X85, 0XC9, 0X1A,
-  0XA4, 0X71, 0X14, 0XBB, 0XA4, 0X46, 0XA4, 0XB4, 0X9C, 0X7B, 0X61, 0X41,
-  0X93, 0XA6, 0X81, 0X59, 0X60, 0X46, 0X7C, 0XB0, 0X18, 0X9E, 0X61, 0X49,
-  0X35, 0X82, 0X24, 0X57, 0XA3, 0X9C, 0XCA, 0X70, 0XCF, 0X05, 0X29, 0XD0,
-  0X70, 0X1A, 0X7D, 0XB5, 0XC1, 0X04, 0X3F, 0X20, 0X53, 0XB1, 0X55, 0X25,
-  0X91, 0X97, 0XA1, 0X13, 0X24, 0X3B, 0X73, 0X6F, 0X86, 0X88, 0X63, 0XA0,
-  0XA9, 0X0C, 0X1E, 0X83, 0XC5, 0XA1, 0X3E, 0XFA, 0X8A, 0XAE, 0XC7, 0XC3,
-  0X93, 0X4F, 0X5D, 0XD4, 0XDE, 0X47, 0XD7, 0X37, 0X93, 0XC9, 0XD9, 0XE4,
-  0X77, 0XC8, 0X08, 0XF7, 0XD1, 0X6F, 0X67, 0X93, 0XB3, 0XE9, 0XE9, 0XF8,
-  0XA4, 0X8B, 0X0E, 0XF6, 0XD1, 0XEC, 0XEC, 0X62, 0X7C, 0X79, 0X33, 0XEB,
-  0XA2, 0X77, 0X4F, 0X47, 0X05, 0X5C, 0X33, 0XE0, 0X37, 0X43, 0XA5, 0XF0,
-  0XCE, 0X0C, 0XB1, 0XD2, 0XDD, 0X32, 0X32, 0X25, 0XB7, 0XC9, 0XE8, 0X15,
-  0XFC, 0XA0, 0X4C, 0X37, 0XF5, 0X09, 0XC3, 0X60, 0XCC, 0XA3, 0X04, 0X90,
-  0X6E, 0X76, 0XF2, 0XF9, 0X00, 0XD2, 0X54, 0XF9, 0X69, 0XCE, 0X52, 0X3E,
-  0X38, 0X33, 0X00, 0XD9, 0X69, 0XB7, 0XDB, 0XF9, 0X6C, 0X62, 0X40, 0X73,
-  0X79, 0X8D, 0X38, 0X5A, 0XBD, 0X56, 0X3E, 0X93, 0X30, 0X2D, 0XCC, 0XD1,
-  0XC1, 0X79, 0X62, 0XB0, 0XF2, 0X8C, 0X85, 0X57, 0X26, 0XD8, 0XC1, 0X35,
-  0XB3, 0X86, 0X11, 0X37, 0X06, 0X80, 0XB0, 0XFC, 0X65, 0X4C, 0X65, 0X31,
-  0X20, 0X1D, 0X4A, 0XC4, 0X3A, 0XDE, 0X9C, 0X59, 0X7A, 0X6A, 0XA8, 0X0D,
-  0XC3, 0XF1, 0X3C, 0X1C, 0X9E, 0XCE, 0X2E, 0XCE, 0X4B, 0XB8, 0XF8, 0X46,
-  0X5C, 0X30, 0X77, 0X1B, 0X6D, 0XC3, 0X25, 0X3B, 0XE6, 0X86, 0X01, 0X6C,
-  0X8B, 0X28, 0X57, 0XB1, 0XC7, 0X0F, 0X88, 0X90, 0XED, 0X0A, 0XD9, 0X36,
-  0XA5, 0XE8, 0X5F, 0XE3, 0X7F, 0X80, 0X82, 0X07, 0XE6, 0XF7, 0XD7, 0XC5,
-  0XF9, 0X29, 0X21, 0X01, 0X0C, 0XC4, 0X38, 0X22, 0X90, 0X12, 0X66, 0X80,
-  0X14, 0XC8, 0XF0, 0X3D, 0X9A, 0XC6, 0X02, 0X6C, 0X8A, 0X55, 0XC2, 0X95,
-  0XE9, 0X30, 0X0C, 0XCD, 0XCD, 0X71, 0XBC, 0X5A, 0XE1, 0X10, 0X40, 0XD9,
-  0X42, 0X10, 0X38, 0XF0, 0XBD, 0X62, 0X95, 0XE1, 0XAC, 0X74, 0X01, 0XB6,
-  0X88, 0XAA, 0XB0, 0X25, 0X11, 0XB5, 0X6F, 0XC0, 0X17, 0X98, 0X61, 0X84,
-  0XCF, 0X3C, 0XA2, 0X53, 0X7E, 0X6F, 0X60, 0X23, 0X7F, 0X19, 0X52, 0X1C,
-  0X22, 0XA6, 0X7D, 0X6A, 0X9E, 0X9D, 0X46, 0XE3, 0X68, 0X1B, 0X3E, 0X96,
-  0X9B, 0XD4, 0X44, 0XD7, 0X79, 0X1E, 0X5D, 0XE2, 0X02, 0XE6, 0X91, 0XF3,
-  0X5F, 0X25, 0XDA, 0XCE, 0XA1, 0X02, 0XEF, 0X41, 0X6D, 0XBC, 0XC9, 0XFE,
-  0X54, 0X31, 0XF8, 0X5E, 0X81, 0X04, 0X56, 0X42, 0X01, 0X88, 0X0D, 0XD7,
-  0XBF, 0XCD, 0XAC, 0X84, 0X29, 0XB1, 0XAF, 0XA1, 0X3D, 0X59, 0XAB, 0X7B,
-  0X48, 0X3B, 0X12, 0XF5, 0X22, 0X42, 0X30, 0X3D, 0X89, 0X00, 0X4B, 0XA8,
-  0XCB, 0XB8, 0X9C, 0X22, 0X98, 0X28, 0X7F, 0X85, 0X44, 0X11, 0X33, 0X3F,
-  0X90, 0X44, 0X1B, 0X5F, 0X5F, 0X5F, 0X5E, 0X77, 0XD1, 0XC8, 0XF4, 0X68,
-  0X66, 0XC8, 0X74, 0X95, 0XE0, 0X61, 0X40, 0XD8, 0XD0, 0XCA, 0X18, 0X20,
-  0X47, 0XC0, 0X43, 0XD7, 0X9D, 0X72, 0X57, 0X18, 0XE9, 0X0A, 0X22, 0XD1,
-  0X83, 0X43, 0X96, 0XB6, 0X2E, 0X8A, 0XA6, 0X32, 0X2A, 0XA6, 0X1C, 0XEA,
-  0XD9, 0X0B, 0X8E, 0XD3, 0XE0, 0X4E, 0XB3, 0X32, 0X91, 0X89, 0X6C, 0XFF,
-  0X81, 0X2F, 0XE1, 0X19, 0XB3, 0X8A, 0X85, 0XAC, 0X82, 0X85, 0XA2, 0XED,
-  0XEE, 0X68, 0X07, 0XD2, 0X89, 0X97, 0XDE, 0X4A, 0XFC, 0X9A, 0XBB, 0XB0,
-  0X6D, 0X74, 0XA5, 0X4D, 0XBF, 0X02, 0X57, 0XA7, 0X6D, 0X01, 0X86, 0XE8,
-  0X33, 0XE3, 0X8E, 0X4E, 0XCF, 0XBC, 0XC3, 0XBE, 0XEC, 0X5C, 0X5F, 0X51,
-  0XC4, 0X2C, 0XF8, 0X6C, 0X97, 0X91, 0XB9, 0X46, 0X5D, 0X4B, 0XA1, 0XB5,
-  0X7D, 0XD1, 0X10, 0XF7, 0X55, 0XE6, 0X56, 0X1C, 0X7C, 0X45, 0X9E, 0XD3,
-  0X18, 0X59, 0X8B, 0XE5, 0X04, 0XF8, 0XBB, 0X71, 0X9C, 0X44, 0X8A, 0X6A,
-  0XE6, 0X2A, 0X63, 0X46, 0XD2, 0XB0, 0X10, 0XE2, 0X0F, 0X3B, 0X95, 0X74,
-  0X14, 0X25, 0X8D, 0X0A, 0XF1, 0X3C, 0XC6, 0XD1, 0X8F, 0XE8, 0XC6, 0XBB,
-  0XF3, 0XFC, 0X07, 0XAF, 0XFA, 0X7C, 0X3E, 0X95, 0X46, 0X78, 0X37, 0XA1,
-  0X0C, 0XF9, 0X83, 0X7A, 0XD9, 0X53, 0X29, 0XD8, 0X30, 0X36, 0XB7, 0X45,
-  0X1B, 0XC9, 0XDA, 0X93, 0XA0, 0X85, 0XD8, 0XAA, 0XA2, 0XD9, 0XEF, 0XA8,
-  0X8A, 0XC4, 0X33, 0X81, 0XEE, 0X97, 0X36, 0X62, 0X1D, 0X21, 0X03, 0X8D,
-  0X6C, 0X4C, 0XCB, 0X01, 0XDB, 0X24, 0X68, 0XE3, 0XC7, 0X10, 0XE5, 0X30,
-  0XA5, 0XEF, 0XF1, 0X52, 0X86, 0XF8, 0X90, 0XDC, 0X0B, 0X8D, 0X3F, 0X03,
-  0X7D, 0X02, 0X98, 0X35, 0XED, 0X5A, 0XD1, 0XC8, 0X4B, 0X4B, 0X9D, 0X1C,
-  0XD8, 0X8A, 0XC3, 0X5C, 0XC3, 0X45, 0X5D, 0X0A, 0X71, 0XFA, 0X68, 0X8B,
-  0X6E, 0XF2, 0X0C, 0X65, 0X37, 0XED, 0XA4, 0XD5, 0X46, 0XA3, 0X9A, 0XAA,
-  0XB0, 0X43, 0X25, 0XBA, 0X01, 0XF6, 0X74, 0XED, 0XF7, 0X31, 0X35, 0X72,
-  0XCD, 0X86, 0X4C, 0XA1, 0XDB, 0X6A, 0X75, 0X7E, 0X3D, 0X30, 0X3A, 0X87,
-  0XBF, 0X18, 0XEF, 0X8D, 0X4E, 0X8B, 0X5B, 0X8B, 0X46, 0X7B, 0X7B, 0X31,
-  0X2E, 0X66, 0X0F, 0X69, 0X12, 0X30, 0XE3, 0X91, 0X57, 0X63, 0X11, 0X6C,
-  0XC1, 0X22, 0X98, 0X56, 0X00, 0X8D, 0XB0, 0X67, 0XA5, 0XF2, 0X3F, 0XC9,
-  0X79, 0X4C, 0X29, 0X0E, 0XE4, 0X42, 0X43, 0X81, 0XA2, 0XBB, 0XA0, 0XEC,
-  0XB4, 0X26, 0XF0, 0X57, 0XAA, 0X7D, 0X8F, 0X8E, 0X37, 0X33, 0XF3, 0X76,
-  0X62, 0XAE, 0XB1, 0XAE, 0X25, 0X90, 0X5A, 0XA3, 0X21, 0XAB, 0X2E, 0X19,
-  0X37, 0X58, 0X25, 0X61, 0X24, 0X85, 0X04, 0XE5, 0X99, 0X96, 0X12, 0X5A,
-  0X69, 0X5F, 0X0A, 0X2C, 0X4A, 0XBE, 0X3A, 0X47, 0XBC, 0X25, 0X82, 0X55,
-  0X67, 0X8A, 0X49, 0X35, 0XD5, 0X28, 0XB3, 0XB2, 0X70, 0XFD, 0XE5, 0X9D,
-  0XA6, 0X64, 0X80, 0X85, 0XE8, 0XAB, 0XA4, 0X7E, 0X12, 0X59, 0X80, 0X8C,
-  0X4B, 0XCA, 0X62, 0X07, 0XFD, 0X42, 0XC6, 0X5B, 0XD0, 0XC3, 0X8E, 0XC7,
-  0X26, 0XA9, 0X98, 0X42, 0X9C, 0XD8, 0X7A, 0XE9, 0X58, 0X68, 0XBB, 0X9E,
-  0XCA, 0XAD, 0X52, 0X67, 0X86, 0X0E, 0X64, 0XC3, 0XB3, 0X24, 0X62, 0XE9,
-  0X62, 0XA2, 0XDF, 0X50, 0X75, 0XA0, 0X9F, 0X53, 0X76, 0X5E, 0X79, 0XCA,
-  0XE2, 0X49, 0X9A, 0X83, 0X8C, 0XA8, 0X25, 0X66, 0X49, 0XC9, 0X71, 0X84,
-  0XE1, 0X48, 0XE0, 0X4E, 0X5C, 0XB2, 0XB7, 0X57, 0X69, 0X2C, 0X72, 0X56,
-  0XF1, 0XB5, 0X06, 0XA7, 0XAC, 0X25, 0X5C, 0X43, 0X3D, 0X62, 0X1F, 0XB4,
-  0XDA, 0X56, 0X79, 0X00, 0X8B, 0X92, 0X04, 0X60, 0XE7, 0XE8, 0X55, 0XCB,
-  0XC4, 0XE5, 0X4D, 0X2A, 0X6C, 0XCE, 0X0E, 0X95, 0X12, 0XAD, 0X85, 0X14,
-  0XE5, 0XD6, 0X2E, 0XB8, 0X9E, 0XD5, 0XDA, 0X33, 0X28, 0X78, 0XC3, 0X40,
-  0XE6, 0X29, 0X49, 0X6E, 0X61, 0XFF, 0X7B, 0X8B, 0X70, 0X20, 0X9A, 0X40,
-  0XE2, 0XED, 0XB6, 0XE4, 0XBC, 0X14, 0X44, 0X0C, 0X03, 0X72, 0X1E, 0X4B,
-  0X67, 0X4B, 0XAE, 0X3D, 0X4F, 0X56, 0XD2, 0X5A, 0XDD, 0X50, 0XD5, 0XE9,
-  0XA5, 0XD8, 0X9B, 0X72, 0XA3, 0X00, 0X56, 0XC4, 0X74, 0X45, 0XF2, 0XF1,
-  0X1C, 0XE5, 0XBC, 0X13, 0X50, 0X8B, 0X76, 0X06, 0XAE, 0XA0, 0XCE, 0X95,
-  0X7D, 0X6A, 0X7A, 0X56, 0X64, 0X9B, 0X77, 0X58, 0X97, 0XAD, 0X6E, 0XBF,
-  0X66, 0XE5, 0XF1, 0X02, 0X19, 0X78, 0XCF, 0XA2, 0X9E, 0XEE, 0X28, 0X68,
-  0X25, 0XEF, 0X57, 0XEB, 0X3B, 0XC7, 0XFA, 0X7E, 0X7C, 0XD3, 0XAE, 0X4A,
-  0X2D, 0XAE, 0X01, 0XB0, 0XDE, 0X6E, 0X57, 0XA6, 0X98, 0X29, 0XD6, 0X9B,
-  0XC9, 0XC7, 0XC9, 0XE5, 0X9F, 0X13, 0X6D, 0X37, 0X3F, 0X5B, 0X71, 0X8A,
-  0XF6, 0XFA, 0X28, 0XAD, 0X36, 0X85, 0X43, 0X54, 0X70, 0X58, 0XA2, 0X47,
-  0X43, 0X35, 0X5C, 0X65, 0X7A, 0XC5, 0X54, 0X08, 0X55, 0X69, 0XB7, 0X8F,
-  0X5D, 0X75, 0X40, 0X90, 0XDA, 0X20, 0X02, 0X36, 0X86, 0X4C, 0XF4, 0X60,
-  0X3B, 0X2E, 0X6E, 0X18, 0X86, 0X78, 0X20, 0X5F, 0XBB, 0X4B, 0XB2, 0X2B,
-  0XB3, 0X3D, 0X62, 0X0F, 0XE0, 0X8C, 0X9E, 0XF4, 0X5A, 0XF0, 0X83, 0X3E,
-  0X1C, 0X4B, 0X4F, 0XD7, 0XF0, 0XC4, 0X1E, 0X0A, 0X9B, 0XFA, 0X06, 0XCD,
-  0X98, 0XC5, 0X86, 0X60, 0XD6, 0X7F, 0XD8, 0XDA, 0X90, 0X50, 0X98, 0X33,
-  0XE4, 0X66, 0X08, 0XB1, 0XEC, 0XCC, 0X61, 0XBD, 0X33, 0XF8, 0XD3, 0XCB,
-  0XB1, 0X19, 0XF4, 0XD7, 0X39, 0XF6, 0X6E, 0X89, 0X7D, 0XC4, 0X00, 0X1C,
-  0X30, 0X82, 0XF7, 0XED, 0XAA, 0XEA, 0X9D, 0X75, 0XE3, 0X42, 0XB1, 0X2B,
-  0XB6, 0X04, 0XDB, 0X85, 0X9A, 0X8D, 0XEB, 0X52, 0XFF, 0X89, 0X84, 0X3F,
-  0X55, 0XD4, 0X54, 0XEC, 0XD2, 0X99, 0X76, 0XD7, 0X42, 0X67, 0X11, 0X13,
-  0X48, 0X01, 0X1D, 0X0B, 0XD2, 0X55, 0X07, 0XB5, 0X28, 0XB9, 0X9A, 0X4B,
-  0X92, 0X06, 0X2E, 0XCD, 0X81, 0X79, 0XDF, 0X72, 0X18, 0X24, 0X37, 0X66,
-  0X15, 0X18, 0X18, 0XBF, 0XD6, 0X3C, 0X8A, 0X1C, 0X6B, 0X1B, 0XD3, 0XD6,
-  0X4F, 0XDB, 0XD7, 0X87, 0X80, 0XE0, 0X5B, 0XD6, 0X2F, 0X5E, 0XCC, 0X40,
-  0XC2, 0XBC, 0X64, 0X95, 0X74, 0XFB, 0X67, 0XF8, 0X91, 0X9C, 0X40, 0XB6,
-  0X67, 0XE1, 0X50, 0XD7, 0X62, 0XB2, 0X6A, 0XFE, 0X02, 0XA6, 0X6B, 0XB1,
-  0X01, 0X3D, 0XDF, 0XDC, 0X28, 0X5E, 0X30, 0XE3, 0XD0, 0XE9, 0XAE, 0XB6,
-  0XF7, 0XD9, 0XE6, 0XBE, 0X3B, 0X68, 0X54, 0XAB, 0XDB, 0X0C, 0XA0, 0XCE,
-  0XB0, 0X46, 0X70, 0X12, 0X2D, 0X3D, 0X21, 0X5D, 0X01, 0X9C, 0XA6, 0XFC,
-  0X7F, 0X73, 0XA3, 0XFA, 0X1B, 0X8C, 0XEA, 0X10, 0XFE, 0XEC, 0XED, 0X35,
-  0XBE, 0X56, 0X96, 0XC5, 0XA9, 0X26, 0X64, 0XCF, 0X13, 0X53, 0X4B, 0X9E,
-  0XF9, 0XA7, 0XF8, 0X31, 0XE7, 0XFC, 0X33, 0XE3, 0XF4, 0X1D, 0XFC, 0XEF,
-  0XEF, 0X2F, 0X0D, 0XEA, 0X96, 0XBA, 0X9A, 0X9A, 0X8D, 0XA7, 0X9A, 0X92,
-  0X2C, 0XB6, 0X88, 0X92, 0X6C, 0XB0, 0XA4, 0XE3, 0X02, 0X27, 0XBF, 0X7E,
-  0X41, 0X4D, 0X74, 0XF0, 0XE1, 0X43, 0X5D, 0XC5, 0X51, 0X7C, 0X15, 0XD4,
-  0X6A, 0XB8, 0X20, 0X09, 0X99, 0XEA, 0X4C, 0X3F, 0XBD, 0X5E, 0X25, 0XBF,
-  0XAB, 0X47, 0X64, 0XD9, 0X94, 0X76, 0XF4, 0XE2, 0X42, 0X35, 0X45, 0XFB,
-  0X96, 0X95, 0X6A, 0XE6, 0X1B, 0XB0, 0X2B, 0X8A, 0X2B, 0X96, 0XE5, 0XD8,
-  0X35, 0X24, 0X7B, 0X00, 0X27, 0X5C, 0XBE, 0X09, 0XF9, 0X91, 0X5E, 0X85,
-  0X94, 0X0A, 0XD4, 0X02, 0X94, 0XB1, 0X74, 0XCD, 0X28, 0X3A, 0X07, 0X99,
-  0X80, 0XFB, 0XB5, 0X7F, 0XCF, 0X8A, 0X5B, 0X0E, 0XA3, 0X35, 0X14, 0XC1,
-  0XB9, 0X84, 0XA0, 0X8F, 0XDD, 0X9C, 0X0F, 0XE0, 0X2B, 0XC7, 0X67, 0X5A,
-  0X96, 0X88, 0X4C, 0X1D, 0X95, 0XF3, 0XD7, 0X48, 0XD0, 0XD7, 0XED, 0XE2,
-  0XF4, 0X15, 0XE2, 0X48, 0XAD, 0X8A, 0X89, 0X0F, 0X95, 0X62, 0XC6, 0XA0,
-  0X91, 0X64, 0X3C, 0XEC, 0X25, 0X02, 0XC8, 0XB2, 0X43, 0X3A, 0XF6, 0X8D,
-  0XED, 0X9D, 0X3A, 0X14, 0X64, 0X02, 0XC5, 0X5E, 0XD6, 0XD3, 0XF7, 0XA8,
-  0XEA, 0XD5, 0X31, 0X9C, 0XFA, 0XDD, 0X61, 0X3E, 0XA2, 0X8B, 0XBD, 0X7F,
-  0X0A, 0X1D, 0X67, 0X21, 0XB9, 0X6E, 0X8C, 0XCE, 0X57, 0X7C, 0X6E, 0X7F,
-  0X11, 0X2F, 0X2F, 0XCA, 0X56, 0X26, 0X59, 0XAB, 0XB0, 0XAE, 0X23, 0XAD,
-  0X7B, 0XEE, 0XB2, 0X8A, 0XBD, 0X87, 0XD2, 0X30, 0XD8, 0X85, 0XB7, 0X1A,
-  0XDF, 0XC1, 0X4E, 0XF8, 0XB2, 0XCB, 0XAF, 0X2D, 0X18, 0XDF, 0XED, 0XC6,
-  0X61, 0XDA, 0X26, 0X2B, 0XA1, 0XDC, 0X31, 0X17, 0X64, 0X7E, 0XE8, 0XEA,
-  0X72, 0X5A, 0XE5, 0X88, 0XC0, 0X14, 0X9A, 0X9C, 0X66, 0X85, 0X2F, 0X62,
-  0X0E, 0X46, 0XBD, 0X6F, 0XCA, 0X56, 0X61, 0XE9, 0X06, 0XF3, 0X15, 0X64,
-  0X56, 0XDF, 0X7C, 0XB2, 0X73, 0X21, 0X34, 0X5B, 0X68, 0X15, 0X8C, 0X49,
-  0X56, 0XE2, 0X4B, 0X4D, 0XA8, 0X7D, 0XF5, 0XFD, 0X6B, 0X85, 0X33, 0X11,
-  0XEF, 0XC5, 0X6B, 0X35, 0X17, 0XB6, 0X5D, 0XCD, 0XBC, 0X64, 0XC3, 0X4E,
-  0XC7, 0XC3, 0X93, 0XAA, 0X0D, 0XA3, 0XCC, 0X6D, 0XDB, 0XAB, 0X4A, 0X99,
-  0X76, 0X2A, 0X08, 0XE5, 0X2B, 0XDA, 0XB5, 0XB9, 0X9C, 0X9B, 0X01, 0XF5,
-  0X0F, 0X05, 0XD7, 0X40, 0X27, 0XC0, 0X65, 0X29, 0X66, 0X92, 0X5C, 0X4F,
-  0X35, 0X3C, 0XA7, 0XAF, 0X77, 0X2A, 0XE6, 0X02, 0XCA, 0X9D, 0X62, 0XDC,
-  0XF1, 0X2C, 0XFC, 0X28, 0XEF, 0X7B, 0X9A, 0X77, 0X09, 0XC9, 0XFC, 0X61,
-  0X9E, 0XB9, 0X77, 0X8A, 0XE1, 0X3D, 0XE1, 0X5F, 0X4E, 0XB3, 0X64, 0XB1,
-  0X3F, 0X73, 0X2A, 0X7B, 0XC8, 0XF9, 0XA2, 0XEC, 0XDA, 0XA5, 0X4C, 0XA4,
-  0X60, 0X87, 0XDF, 0XC4, 0X0C, 0XD5, 0XD9, 0XF7, 0XE3, 0X46, 0X85, 0XFB,
-  0XCB, 0X16, 0X0E, 0XD9, 0XDE, 0XD5, 0X62, 0XAF, 0X53, 0X64, 0X31, 0X5D,
-  0XCE, 0XF7, 0X18, 0X70, 0X4C, 0X09, 0XBD, 0X6C, 0X30, 0X56, 0XA1, 0XBF,
-  0X1E, 0XD9, 0X66, 0X38, 0XA2, 0XA9, 0X79, 0X5D, 0X64, 0XD5, 0XF2, 0X2A,
-  0X25, 0XA2, 0X28, 0X14, 0X16, 0X35, 0X5F, 0X7A, 0XE4, 0X59, 0XEB, 0X51,
-  0X5D, 0XA3, 0X37, 0X39, 0XB9, 0X2D, 0X8A, 0X82, 0X04, 0X03, 0X8A, 0X8A,
-  0X7F, 0XA3, 0XCE, 0X61, 0X83, 0XE6, 0X15, 0X6D, 0X45, 0XD6, 0XCF, 0X8D,
-  0X7A, 0XAF, 0X5F, 0X6A, 0XCC, 0X29, 0X00, 0X5A, 0XB4, 0X70, 0X19, 0XB0,
-  0X9E, 0X0E, 0XFA, 0X17, 0XED, 0XEE, 0XE6, 0XFC, 0XD3, 0XE4, 0X1F, 0XF5,
-  0XD8, 0X7C, 0X15, 0X0E, 0X0E, 0XD7, 0X17, 0X75, 0X50, 0XCE, 0X92, 0X33,
-  0X6A, 0X2F, 0X36, 0XBD, 0XE7, 0XDA, 0X2A, 0XE9, 0XCB, 0X48, 0X85, 0X9C,
-  0X67, 0X87, 0XF6, 0XA6, 0X0A, 0X03, 0XD5, 0XCF, 0XC5, 0X70, 0X04, 0X79,
-  0X53, 0XA6, 0X06, 0X60, 0X31, 0X3D, 0XD7, 0X99, 0XEE, 0X0A, 0X3A, 0XFE,
-  0X16, 0X4A, 0XD3, 0XD9, 0XB0, 0X48, 0X8A, 0X9D, 0XDA, 0XD7, 0XA6, 0XA5,
-  0X8F, 0X1B, 0XB4, 0X9B, 0X22, 0XD2, 0XE2, 0XE7, 0X2F, 0X23, 0X84, 0XF4,
-  0X74, 0X30, 0X39, 0X55, 0X48, 0X6B, 0XBC, 0X02, 0XE1, 0X9C, 0X5E, 0X62,
-  0X14, 0XAF, 0X2D, 0X19, 0X45, 0X73, 0X6A, 0X46, 0XF6, 0XD2, 0X64, 0X57,
-  0X99, 0XD6, 0X86, 0X1E, 0XBC, 0XB5, 0X49, 0XBA, 0XDA, 0X5B, 0XF0, 0XFE,
-  0XB3, 0X6C, 0X10, 0X3F, 0X8B, 0X9B, 0X96, 0X0D, 0X30, 0XCD, 0XAA, 0X25,
-  0X55, 0X06, 0XCC, 0XDD, 0XBA, 0XBF, 0X5F, 0X5F, 0XF1, 0X90, 0X30, 0XF7,
-  0XB5, 0X34, 0X83, 0XB9, 0XEB, 0X78, 0X77, 0XD5, 0X4D, 0X13, 0XCD, 0X14,
-  0X6B, 0X91, 0X6C, 0X41, 0XA1, 0X63, 0X64, 0X87, 0X78, 0X45, 0XF3, 0X09,
-  0X98, 0X86, 0X3A, 0X02, 0X1B, 0X14, 0X4E, 0XBD, 0X2E, 0X0D, 0XCD, 0X27,
-  0XFE, 0X03, 0X6F, 0X23, 0X5E, 0X8D, 0XA0, 0X54, 0X59, 0X39, 0X2E, 0X2E,
-  0XF0, 0X66, 0X2F, 0X61, 0XCD, 0XE3, 0X4E, 0XDC, 0X09, 0X4B, 0X9E, 0XE1,
-  0X8F, 0X43, 0X56, 0XAD, 0X2D, 0XF1, 0X78, 0X3A, 0X02, 0X26, 0XFF, 0X2A,
-  0X72, 0XF9, 0X62, 0XDB, 0X0A, 0XB8, 0X61, 0X65, 0X3A, 0XC9, 0X5E, 0X69,
-  0XE3, 0X86, 0X13, 0X0C, 0X5E, 0X8F, 0X88, 0X28, 0XD6, 0X36, 0X32, 0X4C,
-  0XE3, 0XA9, 0X2D, 0X46, 0X05, 0X53, 0XA9, 0X17, 0XCE, 0XB6, 0X84, 0X31,
-  0X01, 0XF3, 0XF6, 0XC8, 0X50, 0X8C, 0XF4, 0X10, 0XFF, 0X68, 0XF8, 0XFB,
-  0XD0, 0XA6, 0XD1, 0XEF, 0XFD, 0XAF, 0XAA, 0X7E, 0XA9, 0X8C, 0X5B, 0XFB,
-  0X8F, 0XA7, 0X55, 0X85, 0XA7, 0XA7, 0X57, 0X50, 0X6A, 0X08, 0X47, 0X3A,
-  0X73, 0X0D, 0X22, 0XE9, 0XFC, 0XC4, 0XB7, 0X28, 0X90, 0XFA, 0XCC, 0X0B,
-  0X92, 0XB3, 0X9F, 0XC2, 0X81, 0X4E, 0X3E, 0X4D, 0XD1, 0XB5, 0X76, 0X9B,
-  0XA2, 0X66, 0XD3, 0X06, 0XF1, 0X79, 0X76, 0XA3, 0X43, 0XFC, 0X87, 0X5A,
-  0XDA, 0X75, 0X96, 0X58, 0X6F, 0X1E, 0XA8, 0X13, 0XF0, 0XCA, 0X6F, 0X1D,
-  0XB0, 0X5B, 0XC7, 0X6F, 0X54, 0XBE, 0X66, 0X99, 0XDF, 0X47, 0X4A, 0XAF,
-  0X6C, 0X96, 0X6E, 0XF3, 0XB2, 0X32, 0X0C, 0XBB, 0X49, 0X7D, 0XD5, 0X78,
-  0XA5, 0X3B, 0X3D, 0XF9, 0X9D, 0X2F, 0X0E, 0X25, 0X7F, 0X7E, 0XA2, 0X35,
-  0XDE, 0XFA, 0X6E, 0X4F, 0XE2, 0X21, 0X83, 0X7B, 0X9E, 0X8B, 0X1D, 0X6B,
-  0X52, 0X50, 0XF6, 0X61, 0X5B, 0XF1, 0XE2, 0X1F, 0X96, 0X95, 0XAF, 0X7F,
-  0XD6, 0X4E, 0XC6, 0XC3, 0X9B, 0XD9, 0XE9, 0XFC, 0XFA, 0XF2, 0XF7, 0X9B,
-  0XF1, 0X1C, 0X3C, 0XA8, 0X9E, 0X28, 0XA6, 0X41, 0XDD, 0X5C, 0X32, 0X79,
-  0X7C, 0X7D, 0X39, 0X3C, 0X19, 0X0D, 0XA7, 0X33, 0XA4, 0X0F, 0X47, 0XB3,
-  0X74, 0X12, 0X5C, 0XD9, 0XEC, 0XE6, 0X7A, 0X3C, 0XBF, 0X9C, 0X9C, 0X7F,
-  0X12, 0X96, 0X7D, 0X79, 0XD3, 0XBB, 0X45, 0X79, 0X0F, 0X59, 0X02, 0XFA,
-  0X06, 0XBA, 0XFB, 0XF0, 0X76, 0XD7, 0X8C, 0X92, 0X00, 0X00, 0XF1, 0X16,
-  0XEC, 0X77, 0X0E, 0XDE, 0X7A, 0XEF, 0X93, 0XC9, 0XD1, 0XE5, 0XC5, 0XF1,
-  0XD9, 0X04, 0XD6, 0X9E, 0X9F, 0XD7, 0XDD, 0XF7, 0XCA, 0X9B, 0X52, 0X49,
-  0X31, 0XE9, 0X5B, 0X74, 0XC2, 0XC5, 0X7F, 0X8D, 0XB3, 0XF9, 0XA4, 0XEE,
-  0X2E, 0X17, 0XE4, 0X36, 0XC5, 0X27, 0XD6, 0XF3, 0X7A, 0X89, 0X5F, 0XE3,
-  0XCD, 0X63, 0X21, 0X35, 0X48, 0X3F, 0XD2, 0XD1, 0X4A, 0X3D, 0X26, 0X91,
-  0X94, 0X01, 0X31, 0X70, 0X6C, 0X82, 0X9B, 0XCB, 0X3A, 0XFC, 0X1C, 0XE3,
-  0X3E, 0X2F, 0XE1, 0X0A, 0XAE, 0X8E, 0X06, 0XCB, 0XE4, 0XAB, 0XA0, 0XEA,
-  0XD4, 0X85, 0X03, 0X14, 0XD5, 0XC3, 0X47, 0X33, 0X93, 0XE0, 0X05, 0XA2,
-  0X0A, 0X22, 0X49, 0X52, 0X38, 0X1B, 0X4A, 0X88, 0XEC, 0X3B, 0XA4, 0X3E,
-  0X6B, 0XE6, 0XD4, 0XEC, 0X28, 0X17, 0X15, 0X26, 0XDE, 0X92, 0X70, 0XC4,
-  0X62, 0XD5, 0X26, 0XC5, 0XA2, 0X5E, 0X2B, 0XFD, 0X74, 0XA3, 0XD7, 0XA2,
-  0X5F, 0XA2, 0XB2, 0X0F, 0X53, 0XE9, 0X47, 0XC9, 0XFF, 0X03, 0XCA, 0XDB,
-  0X6A, 0X2E, 0XAB, 0X3C, 0X00, 0X00
+  0XB1, 0XAA, 0X46, 0X72, 0XF5, 0X66, 0X6B, 0X91, 0XED, 0X58, 0X16, 0XF6,
+  0X7A, 0XA3, 0XF1, 0X0C, 0XF5, 0XFF, 0XEC, 0X9F, 0X9D, 0XF7, 0X8F, 0XCF,
+  0X87, 0XFF, 0X2F, 0X3D, 0X11, 0X67, 0X8D, 0XFD, 0X98, 0XE4, 0X07, 0X8D,
+  0X3F, 0X23, 0X1D, 0X5C, 0XB2, 0XEF, 0X59, 0X51, 0XED, 0X09, 0X9D, 0X39,
+  0X5E, 0X00, 0XD0, 0XDC, 0X2D, 0X79, 0XF1, 0X7A, 0X81, 0X43, 0X0D, 0XAD,
+  0X1D, 0X8F, 0X9D, 0X8D, 0XB5, 0X79, 0X0F, 0X06, 0XF6, 0XFE, 0XBD, 0X26,
+  0X1D, 0XCA, 0X84, 0X60, 0XAE, 0XA0, 0X54, 0XB9, 0X8D, 0X1F, 0X95, 0X2E,
+  0X71, 0X77, 0X5C, 0X92, 0X1F, 0XF4, 0X7E, 0X30, 0X06, 0X91, 0XA3, 0X97,
+  0X06, 0XD6, 0XF2, 0X68, 0X15, 0X7B, 0X1E, 0X0D, 0X74, 0X4F, 0XC6, 0XAB,
+  0X19, 0XC8, 0X8D, 0X30, 0X4B, 0X3E, 0XAC, 0X36, 0XE0, 0X08, 0X4C, 0X09,
+  0X41, 0X3D, 0X08, 0XFD, 0X6B, 0XF0, 0XDA, 0X3C, 0XAE, 0XC2, 0X64, 0X05,
+  0XD2, 0X38, 0X8A, 0X5D, 0X52, 0X21, 0X52, 0X5A, 0XCE, 0XAD, 0XB0, 0XA0,
+  0X4E, 0XD3, 0XC0, 0X2C, 0X30, 0X23, 0X3E, 0X58, 0X0C, 0XCF, 0XB0, 0XA4,
+  0X1C, 0X41, 0X92, 0XAB, 0X51, 0X4E, 0X65, 0XB8, 0XA7, 0X82, 0X14, 0X68,
+  0X38, 0X8D, 0XBE, 0X5A, 0X6F, 0X84, 0XEF, 0X90, 0XA9, 0XD8, 0XAA, 0X0D,
+  0X91, 0X97, 0XA1, 0X13, 0X24, 0X3B, 0X73, 0X6B, 0X86, 0X88, 0X63, 0XA0,
+  0XA9, 0X0C, 0X1E, 0X82, 0XC5, 0XA1, 0X2E, 0XFA, 0X8E, 0X26, 0XC3, 0XFE,
+  0XC9, 0XE7, 0X36, 0X6A, 0XEE, 0XA3, 0XC9, 0XD5, 0X68, 0X74, 0X36, 0XFA,
+  0X03, 0X32, 0XC2, 0X7D, 0XF4, 0XF1, 0X6C, 0X74, 0X36, 0X3D, 0X1D, 0X9E,
+  0XB4, 0XD1, 0XC1, 0X3E, 0X9A, 0X9D, 0X5D, 0X0C, 0XC7, 0X57, 0XB3, 0X36,
+  0X7A, 0XFB, 0X78, 0X54, 0XC0, 0X35, 0X03, 0X7E, 0X33, 0X54, 0X0A, 0XEF,
+  0XCC, 0X10, 0X2B, 0XDD, 0X2D, 0X23, 0XB3, 0XE1, 0X36, 0X19, 0XBD, 0X82,
+  0X1F, 0X94, 0XE9, 0XA6, 0X3E, 0XA1, 0X1F, 0X0C, 0X79, 0X94, 0X00, 0XD2,
+  0XF5, 0X56, 0X3E, 0X1F, 0X40, 0X9A, 0X2A, 0X3F, 0XCD, 0X59, 0XCA, 0X07,
+  0X67, 0X06, 0X20, 0X5B, 0XCD, 0X66, 0X33, 0X9F, 0X4D, 0X0C, 0X68, 0X2E,
+  0XAF, 0X11, 0X47, 0XCB, 0XD7, 0XCA, 0X67, 0X12, 0XA6, 0X85, 0X39, 0X3A,
+  0X38, 0X4F, 0X0C, 0X56, 0X9E, 0XB1, 0XF0, 0XCA, 0X04, 0X3B, 0X98, 0X30,
+  0X6B, 0X18, 0X70, 0X63, 0X00, 0X08, 0XCB, 0X5F, 0XC6, 0X54, 0X16, 0X03,
+  0XD2, 0XA1, 0X44, 0XAC, 0XE3, 0X87, 0X33, 0X4B, 0X4F, 0X0D, 0XB5, 0X66,
+  0X38, 0X9E, 0X87, 0XC3, 0XD3, 0XD9, 0XC5, 0XF9, 0X06, 0X2E, 0XBE, 0X11,
+  0X17, 0XCC, 0XDD, 0X46, 0XDB, 0X70, 0XC9, 0X8E, 0XB9, 0X66, 0X00, 0XDB,
+  0X22, 0XCA, 0X55, 0XEC, 0XF1, 0X03, 0X22, 0X64, 0XBB, 0X42, 0XB6, 0X4D,
+  0X29, 0XFA, 0X13, 0XFC, 0X0F, 0X50, 0XF0, 0XC0, 0XFC, 0XFE, 0XBE, 0X38,
+  0X3F, 0X25, 0X24, 0X80, 0X81, 0X18, 0X47, 0X04, 0X52, 0XC2, 0X0C, 0X90,
+  0X02, 0X19, 0XBE, 0X47, 0XD3, 0X58, 0X80, 0X4D, 0XB1, 0X4A, 0XB8, 0X32,
+  0X1D, 0X86, 0XA1, 0XF9, 0X70, 0X1C, 0XAF, 0X56, 0X38, 0X04, 0X50, 0XB6,
+  0X10, 0X04, 0X0E, 0X7C, 0XAF, 0X58, 0X65, 0X38, 0X2B, 0X5D, 0X80, 0X2D,
+  0XA2, 0X2A, 0X6C, 0X49, 0X44, 0XED, 0X1B, 0XF0, 0X05, 0X66, 0X18, 0XE1,
+  0X33, 0X8F, 0XE8, 0X94, 0XDF, 0X2B, 0XD8, 0XC8, 0XDF, 0XFB, 0X14, 0X87,
+  0X88, 0X69, 0X9F, 0X9A, 0X67, 0XAB, 0X56, 0X3B, 0XDA, 0X86, 0X8F, 0XE5,
+  0X26, 0X15, 0XD1, 0XB5, 0X9E, 0X46, 0X97, 0XB8, 0X80, 0X79, 0XE4, 0XFC,
+  0X57, 0X89, 0XB6, 0X75, 0XA8, 0XC0, 0X7B, 0X50, 0X19, 0X6F, 0XB2, 0X3F,
+  0X65, 0X0C, 0XBE, 0X53, 0X20, 0X81, 0X95, 0X50, 0X00, 0X62, 0XC3, 0XF5,
+  0XAF, 0X33, 0X2B, 0X61, 0X4A, 0XEC, 0X6A, 0X68, 0X4F, 0XD6, 0XEA, 0X1E,
+  0XD2, 0X8E, 0X44, 0XBD, 0X88, 0X10, 0X4C, 0X4F, 0X22, 0XC0, 0X12, 0XEA,
+  0X32, 0X2E, 0XA7, 0X08, 0X26, 0XCA, 0X5F, 0X22, 0X51, 0XC4, 0XCC, 0X0F,
+  0X24, 0XD1, 0X86, 0X93, 0XC9, 0X78, 0XD2, 0X46, 0X03, 0XD3, 0XA3, 0X99,
+  0X21, 0XD3, 0X55, 0X82, 0X87, 0X01, 0X61, 0X43, 0XDB, 0XC4, 0X00, 0X39,
+  0X02, 0XEE, 0XBB, 0XEE, 0X94, 0XBB, 0XC2, 0X48, 0X57, 0X10, 0X89, 0XEE,
+  0X1C, 0XB2, 0XB4, 0X75, 0X51, 0X34, 0X95, 0X51, 0X31, 0XE5, 0X50, 0XCF,
+  0X5E, 0X70, 0X9C, 0X06, 0X77, 0X9A, 0XA5, 0X89, 0X4C, 0X64, 0XFB, 0X77,
+  0X7C, 0X09, 0XCF, 0X98, 0X55, 0X2C, 0X64, 0X15, 0X2C, 0X14, 0X6D, 0X37,
+  0X47, 0X3B, 0X90, 0X4E, 0XBC, 0XF4, 0X56, 0XE2, 0X13, 0XEE, 0XC2, 0XB6,
+  0XD1, 0X95, 0X36, 0XFD, 0X12, 0X5C, 0X9D, 0XB6, 0X05, 0X18, 0XA2, 0XCF,
+  0X8C, 0X3B, 0X3A, 0X3D, 0XF3, 0X0E, 0XFB, 0XB2, 0X73, 0X7D, 0X41, 0X11,
+  0XB3, 0XE0, 0XB3, 0X5D, 0X46, 0XE6, 0X1A, 0X75, 0X2D, 0X85, 0XD6, 0XF6,
+  0X45, 0X43, 0XDC, 0X57, 0X99, 0X5B, 0X71, 0XF0, 0X05, 0X79, 0X4E, 0X63,
+  0X64, 0X25, 0X96, 0X13, 0XE0, 0X9F, 0XC6, 0X71, 0X12, 0X29, 0XCA, 0X99,
+  0X2B, 0X8D, 0X19, 0X49, 0XC3, 0X42, 0X88, 0X3F, 0XEC, 0X54, 0XD2, 0X51,
+  0X94, 0X34, 0X2A, 0XC4, 0XF3, 0X18, 0X47, 0X6F, 0XD0, 0X95, 0X77, 0XE3,
+  0XF9, 0X77, 0X5E, 0XF9, 0XF9, 0X7C, 0XDC, 0X18, 0XE1, 0XDD, 0X84, 0X4D,
+  0XC8, 0X5F, 0XD4, 0XCB, 0X1E, 0X37, 0X82, 0X0D, 0X63, 0X73, 0X5B, 0XB4,
+  0X91, 0XAC, 0X3D, 0X09, 0X5A, 0X88, 0XAD, 0X2A, 0X9A, 0XFD, 0X8E, 0XAA,
+  0X48, 0X3C, 0X13, 0XE8, 0X7E, 0X69, 0X23, 0XD6, 0X11, 0X32, 0XD0, 0XC0,
+  0XC6, 0XB4, 0X1C, 0XB0, 0X4D, 0X82, 0X1E, 0XFC, 0X18, 0XA2, 0X1C, 0XA6,
+  0XF4, 0X3D, 0X5E, 0XCA, 0X10, 0X1F, 0X92, 0X7B, 0XA1, 0XF1, 0X67, 0XA0,
+  0XCF, 0X00, 0XB3, 0XA6, 0X5D, 0X2B, 0X1A, 0X79, 0X69, 0XA9, 0X93, 0X03,
+  0X5B, 0X71, 0X98, 0X6B, 0XB8, 0XA8, 0X4B, 0X21, 0X4E, 0X1F, 0X6D, 0XD1,
+  0X4D, 0X9E, 0XA1, 0XEC, 0XA6, 0X9D, 0XB4, 0XDA, 0XA8, 0X95, 0X53, 0X15,
+  0X76, 0X68, 0X83, 0X6E, 0X80, 0X3D, 0X5D, 0XFB, 0X63, 0X48, 0X8D, 0X5C,
+  0XB3, 0X21, 0X53, 0X68, 0X37, 0X1A, 0XAD, 0X0F, 0X07, 0X46, 0XEB, 0XF0,
+  0X77, 0XE3, 0X9D, 0XD1, 0X6A, 0X70, 0X6B, 0XD1, 0X68, 0X6F, 0X2F, 0XC6,
+  0XC5, 0XEC, 0X21, 0X4D, 0X02, 0X66, 0X3C, 0XF2, 0X6A, 0X2C, 0X82, 0X2D,
+  0X58, 0X04, 0XD3, 0X0A, 0XA0, 0X11, 0XF6, 0XAC, 0X54, 0XFE, 0X47, 0X39,
+  0X8F, 0XD9, 0X88, 0X03, 0XB9, 0XD0, 0X50, 0XA0, 0XE8, 0X2E, 0X28, 0X3B,
+  0XAD, 0X09, 0XFC, 0X95, 0X6A, 0XDF, 0XA3, 0XE3, 0X87, 0X99, 0X79, 0X3D,
+  0X32, 0XD7, 0X58, 0XD7, 0X12, 0X48, 0XAD, 0X56, 0X93, 0X55, 0X97, 0X8C,
+  0X1B, 0XAC, 0X92, 0X30, 0X92, 0X42, 0X82, 0XF2, 0X4C, 0X4B, 0X09, 0X6D,
+  0X63, 0X5F, 0X0A, 0X2C, 0X4A, 0XBE, 0X3A, 0X47, 0XBC, 0X25, 0X82, 0X95,
+  0X67, 0X8A, 0X49, 0X35, 0X55, 0XDB, 0X64, 0X65, 0XE1, 0XFA, 0XCB, 0X1B,
+  0X4D, 0XC9, 0X00, 0X0B, 0XD1, 0X97, 0X49, 0XFD, 0X24, 0XB2, 0X00, 0X19,
+  0X97, 0X94, 0XC5, 0XF6, 0XBA, 0X85, 0X8C, 0XB7, 0XA0, 0X87, 0X1D, 0X8F,
+  0X4D, 0X52, 0X31, 0X85, 0X38, 0XB1, 0XF5, 0X8D, 0X63, 0XA1, 0XED, 0X7A,
+  0X2A, 0XB7, 0X4A, 0X9D, 0X19, 0X3A, 0X90, 0X0D, 0XCF, 0X92, 0X88, 0XA5,
+  0X8B, 0X89, 0X7E, 0X4D, 0XD5, 0X81, 0X7E, 0X4A, 0XD9, 0X79, 0XE5, 0X29,
+  0X8B, 0X27, 0X69, 0X0E, 0X32, 0XA2, 0X86, 0X98, 0X25, 0X25, 0XC7, 0X11,
+  0X86, 0X23, 0X81, 0X3B, 0X71, 0XC9, 0XDE, 0X5E, 0XA9, 0XB1, 0XC8, 0X59,
+  0XC5, 0XF7, 0X0A, 0X9C, 0XB2, 0X96, 0X70, 0X05, 0XF5, 0X88, 0X7D, 0XD0,
+  0X72, 0X5B, 0XE5, 0X01, 0X2C, 0X4A, 0X12, 0X80, 0X9D, 0XA3, 0X57, 0X25,
+  0X13, 0X97, 0X37, 0XA9, 0XB0, 0X39, 0X3B, 0X54, 0X4A, 0XB4, 0X16, 0X52,
+  0X94, 0X5B, 0XBB, 0XE0, 0X7A, 0X52, 0X6B, 0X4F, 0XA0, 0XE0, 0X0D, 0X03,
+  0X99, 0XA7, 0X24, 0XB9, 0X85, 0XFD, 0XEF, 0X2C, 0XC2, 0X9E, 0X68, 0X02,
+  0X89, 0XB7, 0XDB, 0X92, 0XF3, 0X52, 0X10, 0X31, 0X0C, 0XC8, 0X79, 0X2C,
+  0X9D, 0XDD, 0X70, 0XED, 0X79, 0XB2, 0X92, 0XD6, 0XEA, 0X86, 0XAA, 0X4E,
+  0XDF, 0X88, 0XBD, 0X29, 0X37, 0X0A, 0X60, 0X45, 0X4C, 0X57, 0X24, 0X1F,
+  0X4F, 0X51, 0XCE, 0X3B, 0X01, 0X95, 0X68, 0X67, 0XE0, 0X0A, 0XEA, 0X5C,
+  0XD9, 0XA7, 0XA6, 0X67, 0X45, 0XB6, 0X79, 0X83, 0X75, 0XD9, 0XEA, 0XF6,
+  0X2B, 0X56, 0X1E, 0XCF, 0X90, 0X81, 0XF7, 0X2C, 0XAA, 0XE9, 0X8E, 0X82,
+  0X96, 0XF2, 0X7E, 0XB9, 0XBE, 0X71, 0XAC, 0X9F, 0XC7, 0X37, 0XED, 0XAA,
+  0X54, 0XE2, 0X1A, 0X00, 0XAB, 0XED, 0X76, 0X69, 0X8A, 0X99, 0X62, 0XBD,
+  0X1A, 0X7D, 0X1A, 0X8D, 0XFF, 0X1A, 0X69, 0XBB, 0XF9, 0XD9, 0X92, 0X53,
+  0XB4, 0XD7, 0X45, 0X69, 0XB5, 0X29, 0X1C, 0XA2, 0X82, 0XC3, 0X12, 0X3D,
+  0X1A, 0XAA, 0XE0, 0X2A, 0XD3, 0X2B, 0XA6, 0X42, 0XA8, 0X4A, 0XBB, 0X7D,
+  0XEC, 0XAA, 0X03, 0X82, 0XD4, 0X03, 0X22, 0X60, 0X63, 0XC8, 0X44, 0X77,
+  0XB6, 0XE3, 0XE2, 0X9A, 0X61, 0X88, 0X07, 0XF2, 0XA5, 0XBB, 0X24, 0XBB,
+  0X32, 0XDB, 0X21, 0X76, 0X0F, 0XCE, 0XE8, 0X49, 0XA7, 0X01, 0X3F, 0XE8,
+  0XC3, 0XB1, 0XF4, 0X34, 0X81, 0X27, 0XF6, 0X50, 0XD8, 0XD4, 0X57, 0X68,
+  0XC6, 0X2C, 0X1E, 0X08, 0X66, 0XFD, 0X87, 0XAD, 0X0D, 0X09, 0X85, 0X39,
+  0X43, 0X6E, 0X86, 0X10, 0XCB, 0XCE, 0X1C, 0XD6, 0X3B, 0X83, 0X3F, 0X9D,
+  0X1C, 0X9B, 0X41, 0X7F, 0X9D, 0X63, 0XEF, 0X9A, 0XD8, 0X47, 0X0C, 0XC0,
+  0X01, 0X23, 0X78, 0XD7, 0X2C, 0XAB, 0XDE, 0X59, 0X37, 0X2E, 0X14, 0XBB,
+  0X62, 0X4B, 0XB0, 0X5D, 0XA8, 0XD9, 0XB8, 0X2E, 0XF5, 0X5F, 0X49, 0XF8,
+  0X6B, 0X49, 0X4D, 0XC5, 0X2E, 0X9D, 0X69, 0X77, 0X2D, 0X74, 0X16, 0X31,
+  0X81, 0X14, 0XD0, 0XB1, 0X20, 0X5D, 0X75, 0X50, 0X83, 0X92, 0XAB, 0XB8,
+  0X24, 0X69, 0XE0, 0XD2, 0X1C, 0X98, 0XF7, 0X2D, 0XFB, 0X41, 0X72, 0X63,
+  0X56, 0X82, 0X81, 0XF1, 0X6B, 0XCD, 0XA3, 0XC8, 0XB1, 0XB6, 0X31, 0X6D,
+  0XFD, 0XBA, 0X7D, 0X7D, 0X08, 0X08, 0X7E, 0X64, 0XFD, 0XE2, 0XD9, 0X0C,
+  0X24, 0XCC, 0X4B, 0X56, 0X49, 0XB7, 0X7F, 0X86, 0XEF, 0XC9, 0X09, 0X64,
+  0X7B, 0X16, 0X0E, 0X75, 0X2D, 0X26, 0XAB, 0XFA, 0XEF, 0X60, 0XBA, 0X16,
+  0X1B, 0XD0, 0XF3, 0XCD, 0X8D, 0XE2, 0X05, 0X33, 0X0E, 0X9D, 0XEE, 0X6A,
+  0X73, 0X9F, 0X6D, 0XEE, 0XDB, 0X83, 0X5A, 0XB9, 0XBA, 0XCD, 0X00, 0XEA,
+  0X0C, 0X6B, 0X00, 0X27, 0XD1, 0XD2, 0X13, 0XD2, 0X25, 0XC0, 0X69, 0XCA,
+  0XFF, 0X8D, 0X1B, 0XD5, 0X37, 0X30, 0XAA, 0X43, 0XF8, 0XB3, 0XB7, 0X57,
+  0XFB, 0X5E, 0X5A, 0X16, 0XA7, 0X9A, 0X90, 0X3D, 0X4F, 0X4C, 0X2D, 0X79,
+  0XE6, 0X9F, 0XE2, 0XFB, 0X9C, 0XF3, 0X2F, 0X8C, 0XD3, 0XB7, 0XF0, 0XBF,
+  0X6F, 0X5F, 0X6B, 0XD4, 0X2D, 0XB5, 0X35, 0X35, 0X1B, 0X8F, 0X15, 0X25,
+  0X59, 0X6C, 0X11, 0X25, 0XD9, 0X60, 0X49, 0XC7, 0X05, 0X4E, 0X3E, 0X7C,
+  0X45, 0X75, 0X74, 0XF0, 0XFE, 0X7D, 0X55, 0XC5, 0X51, 0X7C, 0X25, 0XD4,
+  0X2A, 0XB8, 0X20, 0X09, 0X99, 0XEA, 0X4C, 0X3F, 0XBE, 0X5C, 0X25, 0XBF,
+  0XAB, 0X47, 0X64, 0XD9, 0X94, 0X76, 0XF4, 0XEC, 0X42, 0X35, 0X45, 0XFB,
+  0X9A, 0X95, 0X6A, 0XE6, 0X1B, 0XB0, 0X2B, 0X8A, 0X2B, 0X96, 0XE5, 0XD8,
+  0X35, 0X24, 0X7B, 0X00, 0X27, 0XBC, 0X79, 0X13, 0XF2, 0X86, 0X5E, 0X85,
+  0X6C, 0X14, 0XA8, 0X05, 0X28, 0X63, 0XE9, 0X9A, 0X51, 0X74, 0X0E, 0X32,
+  0X01, 0XF7, 0X6B, 0XFF, 0X96, 0X15, 0XB7, 0X1C, 0X46, 0XAB, 0X29, 0X82,
+  0XF3, 0X06, 0X82, 0X2E, 0X76, 0X73, 0X3E, 0X80, 0XAF, 0X1C, 0X9F, 0X69,
+  0X59, 0X22, 0X32, 0X75, 0X54, 0XCE, 0X5F, 0X23, 0X41, 0XDF, 0XB7, 0X8B,
+  0XD3, 0X55, 0X88, 0X23, 0XB5, 0X2A, 0X46, 0X3E, 0X54, 0X8A, 0X19, 0X83,
+  0X46, 0X92, 0XF1, 0XB0, 0X97, 0X08, 0X20, 0XCB, 0X0E, 0XE9, 0XD8, 0X0F,
+  0XB6, 0X77, 0XAA, 0X50, 0X90, 0X09, 0X14, 0X7B, 0X59, 0X8F, 0X3F, 0XA3,
+  0XAA, 0X57, 0XC7, 0X70, 0XEA, 0X77, 0XFB, 0XF9, 0X88, 0X2E, 0XF6, 0XFE,
+  0X29, 0X74, 0X9C, 0X85, 0XE4, 0XAA, 0X31, 0X3A, 0X5F, 0XF1, 0XA5, 0XF9,
+  0X55, 0XBC, 0XBC, 0XD8, 0XB4, 0X32, 0XC9, 0X5A, 0X85, 0X75, 0X2D, 0X69,
+  0XDD, 0X53, 0X97, 0X55, 0XEC, 0X3D, 0X94, 0X9A, 0XC1, 0X2E, 0XBC, 0XD5,
+  0XF8, 0X0E, 0X76, 0XC2, 0X97, 0X5D, 0X7E, 0X6D, 0XC1, 0XF8, 0X76, 0X37,
+  0X0E, 0XD3, 0X36, 0XD9, 0X06, 0XCA, 0X1D, 0X73, 0X41, 0XE6, 0X87, 0X2E,
+  0XC7, 0XD3, 0X32, 0X47, 0X04, 0XA6, 0X50, 0XE7, 0X34, 0X4B, 0X7C, 0X11,
+  0X73, 0X30, 0XEA, 0X7D, 0X53, 0XB6, 0X0A, 0X37, 0X6E, 0X30, 0X5F, 0X40,
+  0X66, 0XF5, 0XCD, 0X27, 0X3B, 0X17, 0X42, 0XB3, 0X85, 0X56, 0XC1, 0X98,
+  0X64, 0X25, 0XBE, 0XD4, 0X84, 0XDA, 0X57, 0XDF, 0XBF, 0X96, 0X38, 0X13,
+  0XF1, 0X5E, 0XBC, 0X52, 0X73, 0X61, 0XDB, 0XD5, 0XCC, 0X73, 0X36, 0XEC,
+  0X74, 0XD8, 0X3F, 0X29, 0XDB, 0X30, 0XCA, 0XDC, 0XB6, 0XBD, 0X2A, 0X95,
+  0X69, 0XA7, 0X82, 0X50, 0XBE, 0XA2, 0X5D, 0X9B, 0XCB, 0XB9, 0X19, 0X50,
+  0XFF, 0X50, 0X70, 0X0D, 0X74, 0X02, 0X5C, 0X96, 0X62, 0X26, 0XC9, 0XF5,
+  0X54, 0XC3, 0X73, 0XFA, 0X7A, 0XA7, 0X62, 0X2E, 0XA0, 0XDC, 0X29, 0XC6,
+  0X1D, 0XCF, 0XC2, 0XF7, 0XF2, 0XBE, 0XA7, 0X79, 0X97, 0X90, 0XCC, 0X1F,
+  0XE6, 0X99, 0X7B, 0XAB, 0X18, 0XDE, 0X13, 0XFE, 0XE5, 0X34, 0X4B, 0X16,
+  0XFB, 0X0B, 0XA7, 0XB2, 0X87, 0X9C, 0XAF, 0XCA, 0XAE, 0X5D, 0XCA, 0X44,
+  0X0A, 0X76, 0XF8, 0X43, 0XCC, 0X50, 0X9D, 0XFD, 0X3C, 0X6E, 0X54, 0XB8,
+  0XBF, 0X6E, 0XE1, 0X90, 0XED, 0X5D, 0X25, 0XF6, 0X5A, 0X45, 0X16, 0XD3,
+  0XE5, 0X7C, 0X8F, 0X01, 0XC7, 0X94, 0XD0, 0XCB, 0X06, 0X63, 0X15, 0XFA,
+  0XEB, 0X81, 0X6D, 0X86, 0X03, 0X9A, 0X9A, 0X57, 0X45, 0X56, 0X2E, 0XAF,
+  0X52, 0X22, 0X8A, 0X42, 0X61, 0X51, 0XF3, 0XA5, 0X47, 0X9E, 0XB4, 0X1E,
+  0XD5, 0X35, 0X7A, 0X9D, 0X93, 0XDB, 0XA2, 0X28, 0X48, 0X30, 0XA0, 0XA8,
+  0XF8, 0X37, 0X6A, 0X1D, 0XD6, 0X68, 0X5E, 0XD1, 0X54, 0X64, 0XFD, 0XDC,
+  0XA8, 0XF7, 0XBA, 0X1B, 0X8D, 0X39, 0X05, 0X40, 0X83, 0X16, 0X2E, 0X3D,
+  0XD6, 0XD3, 0X41, 0XFF, 0XA2, 0XDD, 0XDD, 0X9C, 0X7F, 0X9A, 0XFC, 0XA3,
+  0X0E, 0X9B, 0X2F, 0XC3, 0XC1, 0XE1, 0XBA, 0XA2, 0X0E, 0X36, 0XB3, 0XE4,
+  0X8C, 0XDA, 0XB3, 0X4D, 0XEF, 0XA9, 0XB6, 0X4A, 0XFA, 0X32, 0X52, 0X21,
+  0XE7, 0XD9, 0XA1, 0XBD, 0XA9, 0XC2, 0X40, 0XF5, 0X73, 0XD1, 0X1F, 0X40,
+  0XDE, 0X94, 0XA9, 0X01, 0X58, 0X4C, 0XCF, 0X75, 0XA6, 0XBB, 0X82, 0X8E,
+  0X7F, 0X84, 0XD2, 0X74, 0XD6, 0X2F, 0X92, 0X62, 0XA7, 0XF6, 0XA5, 0X69,
+  0XE9, 0XC3, 0X1A, 0XED, 0XA6, 0X88, 0XB4, 0XF8, 0XF9, 0XCB, 0X08, 0X21,
+  0X3D, 0X1D, 0X4C, 0X4E, 0X15, 0XD2, 0X6A, 0X2F, 0X40, 0X38, 0XA7, 0X97,
+  0X18, 0XC5, 0X4B, 0X4B, 0X46, 0XD1, 0X9C, 0X9A, 0X91, 0XBD, 0X34, 0XD9,
+  0X55, 0XA6, 0XF5, 0X40, 0X0F, 0XDE, 0XDA, 0X24, 0X6D, 0XED, 0X35, 0X78,
+  0XFF, 0X4D, 0X36, 0X88, 0XDF, 0XC4, 0X4D, 0XCB, 0X06, 0X98, 0X66, 0XD5,
+  0X92, 0X2A, 0X03, 0XE6, 0X6E, 0XDD, 0XDF, 0XEF, 0X2F, 0X78, 0X48, 0X98,
+  0XFB, 0X5A, 0X9A, 0XC1, 0XDC, 0X75, 0XBC, 0X9B, 0XF2, 0XA6, 0X89, 0X66,
+  0X8A, 0XB5, 0X48, 0XB6, 0XA0, 0XD0, 0X31, 0XB2, 0X43, 0XBC, 0XA2, 0XF9,
+  0X04, 0X4C, 0X43, 0X1D, 0X81, 0X0D, 0X0A, 0XA7, 0X5E, 0X97, 0X86, 0XE6,
+  0X13, 0XFF, 0X8E, 0XB7, 0X11, 0X2F, 0X07, 0X50, 0XAA, 0XAC, 0X1C, 0X17,
+  0X17, 0X78, 0XB3, 0X97, 0XB0, 0XE6, 0X7E, 0X27, 0XEE, 0X84, 0X25, 0X4F,
+  0XF0, 0XC7, 0X21, 0XCB, 0XD6, 0X6E, 0XF0, 0X78, 0X3A, 0X00, 0X26, 0XFF,
+  0X2E, 0X72, 0XF9, 0X6C, 0XDB, 0X0A, 0XB8, 0X61, 0X65, 0X3A, 0XC9, 0X5E,
+  0X69, 0XE3, 0X86, 0X13, 0XF4, 0X5E, 0X8E, 0X88, 0X28, 0XD6, 0X36, 0X32,
+  0X4C, 0XE3, 0XA9, 0X2D, 0X46, 0X05, 0X53, 0XA9, 0X16, 0XCE, 0XB6, 0X84,
+  0X31, 0X01, 0XF3, 0XF6, 0XC8, 0X50, 0X8C, 0XF4, 0X10, 0XFF, 0X68, 0XF8,
+  0X7B, 0XDF, 0XA4, 0XD1, 0XEF, 0XDD, 0X07, 0X55, 0XBF, 0X54, 0XC6, 0XAD,
+  0XFD, 0XC7, 0XD3, 0XCA, 0XC2, 0XD3, 0XE3, 0X0B, 0X28, 0X35, 0X84, 0X23,
+  0X9D, 0XB9, 0X06, 0X91, 0X74, 0X7E, 0XE2, 0X1B, 0X14, 0X48, 0X7D, 0XE6,
+  0X05, 0XC9, 0XD9, 0X4F, 0XE1, 0X40, 0X27, 0X9F, 0XA6, 0XE8, 0X5A, 0XB3,
+  0X49, 0X51, 0XB3, 0X69, 0X83, 0XF8, 0X3C, 0XBB, 0XD1, 0X21, 0XFE, 0X43,
+  0X2D, 0XED, 0X3A, 0X4B, 0XAC, 0XD7, 0X0F, 0XD4, 0X09, 0X78, 0XE9, 0XB7,
+  0X0E, 0XD8, 0XAD, 0XE2, 0X37, 0X4A, 0X5F, 0XB3, 0XCC, 0XEF, 0X23, 0XA5,
+  0X57, 0X36, 0X37, 0X6E, 0XF3, 0XB2, 0X32, 0X0C, 0XBB, 0X49, 0X7D, 0X55,
+  0X7B, 0XA1, 0X3B, 0X3D, 0XF9, 0X9D, 0X2F, 0X0E, 0X25, 0X7F, 0X7E, 0XA2,
+  0XD5, 0X5E, 0XFB, 0X6E, 0X4F, 0XE2, 0X21, 0X83, 0X7B, 0X9A, 0X8B, 0X1D,
+  0X6B, 0X52, 0X50, 0XF6, 0X61, 0X53, 0XF1, 0XE2, 0X1F, 0X96, 0X95, 0XAF,
+  0X7F, 0XD1, 0X4E, 0X86, 0XFD, 0XAB, 0XD9, 0XE9, 0X7C, 0X32, 0XFE, 0XE3,
+  0X6A, 0X38, 0X07, 0X0F, 0XAA, 0X27, 0X8A, 0XA9, 0X51, 0X37, 0X97, 0X4C,
+  0X1E, 0X4F, 0XC6, 0XFD, 0X93, 0X41, 0X7F, 0X3A, 0X43, 0X7A, 0X7F, 0X30,
+  0X4B, 0X27, 0XC1, 0X95, 0XCD, 0XAE, 0X26, 0XC3, 0XF9, 0X78, 0X74, 0XFE,
+  0X59, 0X5E, 0X36, 0X19, 0X5E, 0X9E, 0XF7, 0X3F, 0XCF, 0X3F, 0X4E, 0XC6,
+  0X17, 0XF3, 0X8F, 0XE7, 0XFD, 0XE9, 0X29, 0XD2, 0X47, 0X63, 0X34, 0XE9,
+  0X9F, 0X9C, 0X8D, 0X6B, 0XDA, 0XD7, 0X57, 0XBD, 0X7B, 0X94, 0XF7, 0X98,
+  0X25, 0XA8, 0XAF, 0XA0, 0XDB, 0XF7, 0XAF, 0X77, 0X0D, 0X29, 0X09, 0X00,
+  0X10, 0XAF, 0XC1, 0X7E, 0XEB, 0XE0, 0XB5, 0X6D, 0X23, 0X99, 0X1C, 0X8C,
+  0X2F, 0X8E, 0XCF, 0X46, 0XB0, 0XF6, 0XFC, 0XBC, 0XEA, 0XBE, 0X97, 0XDE,
+  0XA4, 0X4A, 0X8A, 0X49, 0XDF, 0XB2, 0X13, 0X5E, 0X0C, 0XA8, 0X70, 0X76,
+  0X1F, 0XD5, 0XDD, 0XE7, 0X82, 0XDC, 0XA6, 0XF8, 0XC4, 0X7A, 0X62, 0XCF,
+  0XF1, 0X7B, 0XBC, 0XB9, 0X2C, 0XA4, 0X0E, 0XE9, 0X47, 0X3C, 0XDA, 0X46,
+  0X0F, 0X4A, 0X24, 0X65, 0X40, 0X8C, 0X1C, 0X9A, 0XE0, 0X06, 0XB3, 0X1B,
+  0X00, 0X8E, 0X71, 0X9F, 0X97, 0X78, 0X05, 0X57, 0X48, 0X83, 0X69, 0XF2,
+  0XD5, 0X50, 0X79, 0X6A, 0XC3, 0X01, 0X8A, 0XEA, 0XE1, 0XA3, 0X99, 0X49,
+  0XF0, 0X02, 0X52, 0X05, 0X91, 0X24, 0X31, 0X9C, 0X0D, 0X25, 0X44, 0XF6,
+  0X9D, 0X52, 0X97, 0X35, 0X7B, 0X2A, 0X76, 0X9C, 0X8B, 0X0A, 0X13, 0X6F,
+  0X51, 0X38, 0X62, 0XB1, 0XAA, 0X93, 0X62, 0X55, 0XA7, 0X91, 0X7E, 0XDA,
+  0XD1, 0X69, 0XD0, 0X2F, 0X55, 0XD9, 0X87, 0XAB, 0XF4, 0XA3, 0XE5, 0XFF,
+  0X01, 0XE1, 0XFE, 0X6D, 0X77, 0XCB, 0X3C, 0X00, 0X00
 };
-unsigned int page_index_len = 3378;
+unsigned int page_index_len = 3405;
 
 #endif
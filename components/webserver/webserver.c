@@ -11,17 +11,27 @@
  */
 #include "webserver.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "esp_wifi_types.h"
+#include "esp_timer.h"
+#include "esp_system.h"
 
 #include "wifi_controller.h"
 #include "attack.h"
 #include "pcap_serializer.h"
 #include "hccapx_serializer.h"
+#include "hc22000_serializer.h"
+#include "metrics.h"
+#include "log_buffer.h"
+#include "capture_clock.h"
+#include "json_writer.h"
 #include "cJSON.h"
 #include "pages/page_index.h"
 #include <esp_http_server.h>
@@ -31,7 +41,20 @@
 #include "lora.h"
 
 
+/**
+ * @brief Size of serialized status, all numeric fields at their maximum fit in.
+ */
+#define STATUS_BUFFER_SIZE 320
+/**
+ * @brief Size of PCAP part copied and sent at once, one flash page
+ */
+#define PCAP_BUFFER_SIZE 4096
+
 static const char* TAG = "webserver";
+/**
+ * @brief Random value part of PCAP ETag, so ETags of captures from previous boots don't match
+ */
+static unsigned boot_id;
 ESP_EVENT_DEFINE_BASE(WEBSERVER_EVENTS);
 
 /**
@@ -78,22 +101,23 @@ static httpd_uri_t uri_reset_head = {
 //@}
 
 /**
- * @brief Handlers for \c /ap-list endpoint
+ * @brief Flush callback of json_writer, metrics and log buffer that sends data as HTTP chunk.
  *
- * This endpoint returns list of available APs nearby.
- * It calls wifi_controller ap_scanner and serialize their SSIDs into octet response.
- * @attention reponse may take few seconds
- * @attention client may be disconnected from ESP AP after calling this endpoint
- * @param req
+ * @param ctx httpd_req_t of the response
+ * @param data
+ * @param length
  * @return esp_err_t
- * @{
  */
-// ... (your existing code)
+static esp_err_t resp_chunk_write(void *ctx, const char *data, unsigned length){
+    return httpd_resp_send_chunk((httpd_req_t *) ctx, data, length);
+}
 
 /**
  * @brief Handlers for \c /ap-list endpoint
  *
  * This endpoint returns list of available APs nearby in JSON format.
+ * JSON is streamed directly from AP records by chunks, so no JSON document is allocated.
+ * Every AP record is then sent also over LoRa as separate JSON object.
  * @attention reponse may take few seconds
  * @attention client may be disconnected from ESP AP after calling this endpoint
  * @param req
@@ -125,75 +149,97 @@ static const char* get_auth_mode_string(int authmode) {
     }
 }
 
+/**
+ * @brief Writes single cached AP record as JSON object.
+ * 
+ * @param age_ms time since AP was seen by last scan
+ */
+static void write_ap_record(json_writer_t *writer, const wifi_ap_record_t *ap_record, int64_t age_ms){
+    char bssid[18];
+    snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+        ap_record->bssid[0], ap_record->bssid[1], ap_record->bssid[2],
+        ap_record->bssid[3], ap_record->bssid[4], ap_record->bssid[5]);
+    json_writer_begin_object(writer);
+    json_writer_key(writer, "ssid");
+    json_writer_string(writer, (const char *) ap_record->ssid);
+    json_writer_key(writer, "bssid");
+    json_writer_string(writer, bssid);
+    json_writer_key(writer, "rssi");
+    json_writer_int(writer, ap_record->rssi);
+    json_writer_key(writer, "auth_mode");
+    json_writer_string(writer, get_auth_mode_string(ap_record->authmode));
+    json_writer_key(writer, "hidden");
+    json_writer_bool(writer, ap_record->ssid[0] == '\0');
+    json_writer_key(writer, "age_ms");
+    json_writer_int(writer, age_ms);
+    json_writer_end_object(writer);
+}
+
+/**
+ * @brief Sends AP records over LoRa, every record as separate JSON object.
+ */
+static void lora_send_ap_records(const wifictl_ap_records_t *ap_records){
+    // LoRa packet payload is limited to 255 bytes
+    static char packet[255];
+    json_writer_t writer;
+    int64_t now = esp_timer_get_time();
+    lora_send_packet((uint8_t *) "/ap-list", 9);
+
+    json_writer_init(&writer, packet, sizeof(packet), NULL, NULL);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "total");
+    json_writer_uint(&writer, ap_records->count);
+    json_writer_end_object(&writer);
+    ESP_ERROR_CHECK(json_writer_finish(&writer));
+    lora_send_packet((uint8_t *) packet, json_writer_get_length(&writer));
+
+    for(unsigned i = 0; i < ap_records->count; i++){
+        json_writer_init(&writer, packet, sizeof(packet), NULL, NULL);
+        write_ap_record(&writer, &ap_records->records[i], (now - ap_records->last_seen[i]) / 1000);
+        if(json_writer_finish(&writer) != ESP_OK){
+            ESP_LOGE(TAG, "AP record %u doesn't fit into LoRa packet", i);
+            continue;
+        }
+        lora_send_packet((uint8_t *) packet, json_writer_get_length(&writer));
+        ESP_LOGD(TAG, "AP record %u sent over LoRa (%u B)", i, json_writer_get_length(&writer));
+        // give receiver time to process the packet
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    lora_send_packet((uint8_t *) "data sudah terkirim semua", 26);
+}
 
 static esp_err_t uri_ap_list_get_handler(httpd_req_t *req) {
-    wifictl_scan_nearby_aps();
-
-    const wifictl_ap_records_t *ap_records;
-    ap_records = wifictl_get_ap_records();
-
-    cJSON *root = cJSON_CreateArray();
-
-    for (unsigned i = 0; i < ap_records->count; i++) {
-        cJSON *apObject = cJSON_CreateObject();
-        // Mengonversi BSSID dari format biner ke string heksadesimal
-        char bssidStr[18];
-        snprintf(bssidStr, sizeof(bssidStr), "%02X:%02X:%02X:%02X:%02X:%02X",
-                ap_records->records[i].bssid[0], ap_records->records[i].bssid[1],
-                ap_records->records[i].bssid[2], ap_records->records[i].bssid[3],
-                ap_records->records[i].bssid[4], ap_records->records[i].bssid[5]);
-
-        // Menambahkan data ke objek JSON
-        cJSON_AddStringToObject(apObject, "ssid", (const char *)ap_records->records[i].ssid);
-        cJSON_AddStringToObject(apObject, "bssid", bssidStr);
-        cJSON_AddNumberToObject(apObject, "rssi", ap_records->records[i].rssi);
-        cJSON_AddStringToObject(apObject, "auth_mode", get_auth_mode_string(ap_records->records[i].authmode));
-        
-        // Menambahkan informasi apakah jaringan WiFi adalah tersembunyi atau tidak
-        cJSON_AddBoolToObject(apObject, "hidden", (ap_records->records[i].ssid == NULL || strcmp((const char *)ap_records->records[i].ssid, "") == 0));
-
-        // Menambahkan objek AP ke array root
-        cJSON_AddItemToArray(root, apObject);
-    }
-
-    // Pastikan semua objek AP telah ditambahkan
-    if (cJSON_GetArraySize(root) != ap_records->count) {
-        printf("Error: Failed to add all AP objects to the JSON array.\n");
-        cJSON_Delete(root);
-        return ESP_FAIL;
+    // all handlers run in single httpd task, so the buffers don't have to be on its stack
+    static char chunk[256];
+    static wifictl_ap_records_t ap_records_copy;
+    const wifictl_ap_records_t *ap_records = &ap_records_copy;
+    wifictl_get_ap_records(&ap_records_copy);
+    // answer from cache refreshed by background scan, block only if there was no scan yet
+    if(ap_records->updated == 0){
+        wifictl_scan_nearby_aps();
+        wifictl_get_ap_records(&ap_records_copy);
     }
+    int64_t now = esp_timer_get_time();
 
-    const char *jsonStr = cJSON_Print(root);
-    size_t length = strlen(jsonStr);
-    printf("Total length of the JSON string: %zu\n", length);
-    // Kirim respon HTTP dengan JSON string
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_JSON));
-    ESP_ERROR_CHECK(httpd_resp_send(req, jsonStr, strlen(jsonStr)));
-    lora_send_packet((uint8_t*)"/ap-list",9);
-    // Kirim total AP
-    char totalAPStr[20]; // Buffer untuk menyimpan string total AP
-    snprintf(totalAPStr, sizeof(totalAPStr), "{\"total\": %d}", ap_records->count); // Format string total AP
-    lora_send_packet((uint8_t*)totalAPStr, strlen(totalAPStr));
-
-    // Kirim masing-masing objek AP dengan jeda
-    cJSON *item = root->child;
-    while (item != NULL) {
-        const char *jsonObjStr = cJSON_PrintUnformatted(item); // Mengubah objek JSON ke string JSON tanpa pemformatan
-        size_t itemLength = strlen(jsonObjStr);
-        lora_send_packet((uint8_t*)jsonObjStr, itemLength);
-        printf("Packet sent...\n");
-        printf("Total length of the JSON object: %zu\n", itemLength);
-        cJSON_free((void *)jsonObjStr); // Membebaskan memori yang dialokasikan untuk string JSON
-        vTaskDelay(pdMS_TO_TICKS(100)); // Jeda 1 detik (100 ms) antara pengiriman objek AP
-        item = item->next;
-    }
-    lora_send_packet((uint8_t*)"data sudah terkirim semua",26);
-    // Bebaskan memori cJSON
-    cJSON_Delete(root);
+    json_writer_t writer;
+    json_writer_init(&writer, chunk, sizeof(chunk), &resp_chunk_write, req);
+    json_writer_begin_array(&writer);
+    for(unsigned i = 0; i < ap_records->count; i++){
+        write_ap_record(&writer, &ap_records->records[i], (now - ap_records->last_seen[i]) / 1000);
+    }
+    json_writer_end_array(&writer);
+    esp_err_t err = json_writer_finish(&writer);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Error sending AP list");
+        return err;
+    }
+    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, NULL, 0));
+
+    lora_send_ap_records(ap_records);
     return ESP_OK;
 }
 
-
 static httpd_uri_t uri_ap_list_get = {
     .uri = "/ap-list",
     .method = HTTP_GET,
@@ -202,10 +248,6 @@ static httpd_uri_t uri_ap_list_get = {
 };
 //@}
 
-// ... (your existing code)
-
-//@}
-
 /**
  * @brief Handlers for \c /run-attack endpoint
  *
@@ -254,6 +296,11 @@ static esp_err_t uri_run_attack_post_handler(httpd_req_t *req) {
     cJSON *bssid = cJSON_GetObjectItemCaseSensitive(root, "bssid");
     cJSON *attackMethod = cJSON_GetObjectItemCaseSensitive(root, "attack_method");
     cJSON *timeout = cJSON_GetObjectItemCaseSensitive(root, "timeout");
+    // Optional current time of client in milliseconds since Unix epoch, anchors capture timestamps to real time
+    cJSON *time = cJSON_GetObjectItemCaseSensitive(root, "time");
+    if(cJSON_IsNumber(time) && (time->valuedouble > 0)){
+        capture_clock_set_realtime((uint64_t) time->valuedouble * 1000);
+    }
 
     // Lakukan validasi terhadap nilai-nilai JSON yang diperlukan
     if (!cJSON_IsNumber(ap_id) || !cJSON_IsString(ssid) || !cJSON_IsString(bssid) || // Validasi BSSID sebagai string
@@ -296,66 +343,250 @@ static httpd_uri_t uri_run_attack_post = {
 };
 //@}
 
+/**
+ * @brief Serializes current attack status and capture counters into minimal JSON.
+ *
+ * It's shared by \c /status and \c /status-ws endpoints and writes into caller's buffer, so no JSON tree is allocated.
+ * @param buffer
+ * @param size
+ * @return unsigned length of serialized status (not null terminated)
+ */
+static unsigned format_status(char *buffer, unsigned size){
+    const attack_status_t *attack_status = attack_get_status();
+    json_writer_t writer;
+    json_writer_init(&writer, buffer, size, NULL, NULL);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "state");
+    json_writer_uint(&writer, attack_status->state);
+    json_writer_key(&writer, "type");
+    json_writer_uint(&writer, attack_status->type);
+    json_writer_key(&writer, "content_size");
+    json_writer_uint(&writer, attack_status->content_size);
+    json_writer_key(&writer, "status_message");
+    json_writer_string(&writer, ((attack_status->state == FINISHED) || (attack_status->state == TIMEOUT))
+        ? "Attack Finished or Timeout" : "Attack In Progress or Other State");
+    json_writer_key(&writer, "frames");
+    json_writer_uint(&writer, metrics_counter_get(METRICS_SNIFFER_FRAMES_RECEIVED));
+    json_writer_key(&writer, "dropped");
+    json_writer_uint(&writer, metrics_counter_get(METRICS_SNIFFER_FRAMES_DROPPED));
+    json_writer_key(&writer, "eapol_key");
+    json_writer_uint(&writer, metrics_counter_get(METRICS_FRAME_ANALYZER_EAPOLKEY));
+    json_writer_key(&writer, "pmkid");
+    json_writer_uint(&writer, metrics_counter_get(METRICS_FRAME_ANALYZER_PMKID));
+    json_writer_key(&writer, "handshakes");
+    json_writer_uint(&writer, hccapx_serializer_get_count());
+    json_writer_key(&writer, "pcap_size");
+    json_writer_uint(&writer, pcap_serializer_get_size());
+    json_writer_end_object(&writer);
+    // buffer is sized for all fields at their maximum
+    ESP_ERROR_CHECK(json_writer_finish(&writer));
+    return json_writer_get_length(&writer);
+}
+
 /**
  * @brief Handlers for \c /status endpoint
  *
- * This endpoint fetches current status from main component attack wrapper, serialize it and sends it to client as octet stream.
+ * This endpoint fetches current status from main component attack wrapper, serialize it and sends it to client as JSON.
  * @param req
  * @return esp_err_t
  * @{
  */
-
-
 static esp_err_t uri_status_get_handler(httpd_req_t *req) {
+    // all handlers run in single httpd task, so the buffer doesn't have to be on its stack
+    static char status[STATUS_BUFFER_SIZE];
     ESP_LOGD(TAG, "Fetching attack status...");
-    const attack_status_t *attack_status;
-    attack_status = attack_get_status();
-
-    // Create a new JSON object
-    cJSON *json_response = cJSON_CreateObject();
-
-    // Add information to JSON object
-    if (attack_status) {
-        cJSON_AddNumberToObject(json_response, "state", attack_status->state);
-        cJSON_AddNumberToObject(json_response, "content_size", attack_status->content_size);
-
-        // Add a human-readable status message
-        if (attack_status->state == FINISHED || attack_status->state == TIMEOUT) {
-            cJSON_AddStringToObject(json_response, "status_message", "Attack Finished or Timeout");
-        } else {
-            cJSON_AddStringToObject(json_response, "status_message", "Attack In Progress or Other State");
+    unsigned length = format_status(status, sizeof(status));
+    httpd_resp_set_type(req, HTTPD_TYPE_JSON);
+    return httpd_resp_send(req, status, length);
+}
+
+static httpd_uri_t uri_status_get = {
+    .uri = "/status",
+    .method = HTTP_GET,
+    .handler = uri_status_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /status-ws WebSocket endpoint
+ *
+ * Subscribed clients get the same JSON as from \c /status in text frame immediately after connecting, 
+ * on every attack state change and periodically while attack is running, so they don't have to poll \c /status.
+ * 
+ * Subscribers are stored and served only in httpd task (handlers and work queued by httpd_queue_work()), 
+ * so no locking is needed. Client is unsubscribed when sending to it fails or its socket is not WebSocket anymore.
+ * @{
+ */
+static httpd_handle_t server = NULL;
+static int status_clients[CONFIG_WEBSERVER_STATUS_MAX_CLIENTS];
+static unsigned status_client_count = 0;
+static esp_timer_handle_t status_push_timer;
+
+static void status_client_remove(unsigned index){
+    ESP_LOGD(TAG, "Status client %d unsubscribed", status_clients[index]);
+    status_clients[index] = status_clients[--status_client_count];
+}
+
+/**
+ * @brief Sends current status to all subscribed clients. Runs in httpd task.
+ */
+static void status_push_work(void *arg){
+    static char status[STATUS_BUFFER_SIZE];
+    if(status_client_count == 0){
+        return;
+    }
+    httpd_ws_frame_t frame = {
+        .final = true,
+        .type = HTTPD_WS_TYPE_TEXT,
+        .payload = (uint8_t *) status,
+        .len = format_status(status, sizeof(status))
+    };
+    for(unsigned i = status_client_count; i-- > 0;){
+        int fd = status_clients[i];
+        if((httpd_ws_get_fd_info(server, fd) != HTTPD_WS_CLIENT_WEBSOCKET) || (httpd_ws_send_frame_async(server, fd, &frame) != ESP_OK)){
+            status_client_remove(i);
         }
+    }
+}
 
-        // Optionally, add other fields from attack_status if available and relevant
-    } else {
-        cJSON_AddStringToObject(json_response, "error", "No attack status available");
+/**
+ * @brief Schedules status push into httpd task. Called from event loop and timer tasks.
+ */
+static void status_push_schedule(){
+    if(httpd_queue_work(server, &status_push_work, NULL) != ESP_OK){
+        ESP_LOGW(TAG, "Status push not scheduled");
     }
+}
 
-    // Convert JSON object to string
-    char *json_string = cJSON_Print(json_response);
+/**
+ * @brief Callback for ATTACK_EVENT_STATUS_CHANGED event.
+ * 
+ * Pushes new status immediately and keeps periodic push running only while attack is running.
+ * 
+ * @param args not used
+ * @param event_base expects ATTACK_EVENTS
+ * @param event_id expects ATTACK_EVENT_STATUS_CHANGED
+ * @param event_data not used
+ */
+static void attack_status_changed_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data){
+    status_push_schedule();
+    // fails harmlessly if timer is not running
+    esp_timer_stop(status_push_timer);
+    if(attack_get_status()->state == RUNNING){
+        ESP_ERROR_CHECK(esp_timer_start_periodic(status_push_timer, CONFIG_WEBSERVER_STATUS_PUSH_INTERVAL * 1000));
+    }
+}
 
-    // Set response type to JSON
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, json_string, strlen(json_string));
+static void status_push_timer_callback(void *arg){
+    status_push_schedule();
+}
 
-    // Free resources
-    cJSON_Delete(json_response);
-    free(json_string);
+static esp_err_t uri_status_ws_handler(httpd_req_t *req){
+    int fd = httpd_req_to_sockfd(req);
+    if(req->method == HTTP_GET){
+        // handshake done, subscribe new client
+        if(status_client_count == CONFIG_WEBSERVER_STATUS_MAX_CLIENTS){
+            ESP_LOGW(TAG, "Too many status clients, rejecting %d", fd);
+            return ESP_FAIL;
+        }
+        ESP_LOGD(TAG, "Status client %d subscribed", fd);
+        status_clients[status_client_count++] = fd;
+        status_push_work(NULL);
+        return ESP_OK;
+    }
 
-    return ESP_OK;
+    // messages from clients are not expected, but frame has to be received to keep the stream in sync
+    static uint8_t payload[16];
+    httpd_ws_frame_t frame = { .payload = payload };
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+    if((err != ESP_OK) || (frame.len > sizeof(payload))){
+        return ESP_FAIL;
+    }
+    if(frame.len == 0){
+        return ESP_OK;
+    }
+    return httpd_ws_recv_frame(req, &frame, frame.len);
 }
 
-//@}
-static httpd_uri_t uri_status_get = {
-    .uri = "/status",
+static httpd_uri_t uri_status_ws = {
+    .uri = "/status-ws",
     .method = HTTP_GET,
-    .handler = uri_status_get_handler,
-    .user_ctx = NULL
+    .handler = uri_status_ws_handler,
+    .user_ctx = NULL,
+    .is_websocket = true
 };
+//@}
+
+/**
+ * @brief Parses value of HTTP Range header.
+ *
+ * Only single byte range is supported (\c bytes=first-last, \c bytes=first- or \c bytes=-suffix).
+ *
+ * @see Ref: RFC 7233 [2.1]
+ * @param value value of Range header
+ * @param size size of the whole resource
+ * @param first output first byte of range (inclusive)
+ * @param last output last byte of range (inclusive)
+ * @return 0 if range was parsed and is satisfiable
+ * @return 1 if range is malformed or unsupported and whole resource should be sent
+ * @return -1 if range is not satisfiable
+ */
+static int parse_range_header(const char *value, unsigned size, unsigned *first, unsigned *last){
+    if(strncmp(value, "bytes=", 6) != 0){
+        return 1;
+    }
+    value += 6;
+    if(strchr(value, ',') != NULL){
+        // multipart/byteranges responses are not supported
+        return 1;
+    }
+    char *end;
+    if(*value == '-'){
+        unsigned long suffix = strtoul(value + 1, &end, 10);
+        if((end == value + 1) || (*end != '\0')){
+            return 1;
+        }
+        if((suffix == 0) || (size == 0)){
+            return -1;
+        }
+        *first = (suffix >= size) ? 0 : size - suffix;
+        *last = size - 1;
+        return 0;
+    }
+    unsigned long range_first = strtoul(value, &end, 10);
+    if((end == value) || (*end != '-')){
+        return 1;
+    }
+    value = end + 1;
+    unsigned long range_last = size - 1;
+    if(*value != '\0'){
+        range_last = strtoul(value, &end, 10);
+        if((end == value) || (*end != '\0') || (range_last < range_first)){
+            return 1;
+        }
+    }
+    if(range_first >= size){
+        return -1;
+    }
+    if(range_last >= size){
+        range_last = size - 1;
+    }
+    *first = range_first;
+    *last = range_last;
+    return 0;
+}
+
 /**
  * @brief Handlers for \c /capture.pcap endpoint
  *
  * This endpoint forwards PCAP binary data from pcap_serializer via octet stream to client.
+ * PCAP buffer is copied from pcap_serializer and sent by parts of PCAP_BUFFER_SIZE, so it doesn't have to be contiguous in RAM.
+ * 
+ * Single byte range requests are supported, so interrupted download can be resumed.
+ * ETag is made of boot ID and capture generation. Captured data are only appended, so bytes already downloaded 
+ * stay the same while generation doesn't change. Range request with If-Range of another capture is answered by whole capture.
+ * If new capture is started while sending, response is aborted, so client never gets data of two captures.
  *
  * @note Most browsers will start download process when this endpoint is called.
  * @param req
@@ -363,9 +594,73 @@ static httpd_uri_t uri_status_get = {
  * @{
  */
 static esp_err_t uri_capture_pcap_get_handler(httpd_req_t *req){
+    // all handlers run in single httpd task, so the buffer doesn't have to be on its stack
+    static uint8_t pcap_buffer[PCAP_BUFFER_SIZE];
     ESP_LOGD(TAG, "Providing PCAP file...");
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) pcap_serializer_get_buffer(), pcap_serializer_get_size());
+    httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+    // Capture may still be running, serve snapshot of current size
+    const unsigned generation = pcap_serializer_get_generation();
+    const unsigned size = pcap_serializer_get_size();
+    unsigned offset = 0;
+    unsigned end = size;
+
+    char etag[24];
+    snprintf(etag, sizeof(etag), "\"%08x-%x\"", boot_id, generation);
+    httpd_resp_set_hdr(req, "ETag", etag);
+
+    char range[64];
+    char content_range[48];
+    if(httpd_req_get_hdr_value_str(req, "Range", range, sizeof(range)) == ESP_OK){
+        // Only strong ETag matches, dates and truncated values never do
+        char if_range[sizeof(etag)];
+        esp_err_t err = httpd_req_get_hdr_value_str(req, "If-Range", if_range, sizeof(if_range));
+        unsigned first, last;
+        int result = 1;
+        if((err == ESP_ERR_NOT_FOUND) || ((err == ESP_OK) && (strcmp(if_range, etag) == 0))){
+            result = parse_range_header(range, size, &first, &last);
+        }
+        else {
+            ESP_LOGD(TAG, "If-Range doesn't match %s, providing whole PCAP", etag);
+        }
+        if(result < 0){
+            ESP_LOGD(TAG, "Range %s not satisfiable", range);
+            snprintf(content_range, sizeof(content_range), "bytes */%u", size);
+            httpd_resp_set_status(req, "416 Range Not Satisfiable");
+            httpd_resp_set_hdr(req, "Content-Range", content_range);
+            return httpd_resp_send(req, NULL, 0);
+        }
+        if(result == 0){
+            ESP_LOGD(TAG, "Providing PCAP range %u-%u/%u", first, last, size);
+            snprintf(content_range, sizeof(content_range), "bytes %u-%u/%u", first, last, size);
+            httpd_resp_set_status(req, "206 Partial Content");
+            httpd_resp_set_hdr(req, "Content-Range", content_range);
+            offset = first;
+            end = last + 1;
+        }
+    }
+
+    while(offset < end){
+        unsigned length = end - offset;
+        if(length > sizeof(pcap_buffer)){
+            length = sizeof(pcap_buffer);
+        }
+        // copied, so new capture can be started while the data are sent
+        length = pcap_serializer_read(offset, pcap_buffer, length);
+        if(pcap_serializer_get_generation() != generation){
+            ESP_LOGW(TAG, "New capture started while sending PCAP, aborting at offset %u", offset);
+            return ESP_FAIL;
+        }
+        if(length == 0){
+            break;
+        }
+        if(httpd_resp_send_chunk(req, (const char *) pcap_buffer, length) != ESP_OK){
+            ESP_LOGE(TAG, "Sending PCAP chunk failed at offset %u", offset);
+            return ESP_FAIL;
+        }
+        offset += length;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
 static httpd_uri_t uri_capture_pcap_get = {
@@ -380,6 +675,7 @@ static httpd_uri_t uri_capture_pcap_get = {
  * @brief Handlers for \c /capture.hccapx endpoint
  *
  * This endpoint forwards HCCAPX binary data from hccapx_serializer via octet stream to client.
+ * File contains one record per client with complete handshake.
  *
  * @note Most browsers will start download process when this endpoint is called.
  * @param req
@@ -387,9 +683,26 @@ static httpd_uri_t uri_capture_pcap_get = {
  * @{
  */
 static esp_err_t uri_capture_hccapx_get_handler(httpd_req_t *req){
+    // all handlers run in single httpd task, so the record doesn't have to be on its stack
+    static hccapx_t hccapx;
     ESP_LOGD(TAG, "Providing HCCAPX file...");
+    unsigned count = hccapx_serializer_get_count();
+    if(count == 0){
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No complete handshake captured");
+    }
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) hccapx_serializer_get(), sizeof(hccapx_t));
+    for(unsigned i = 0; i < count; i++){
+        // copied, so capture can continue while the record is sent
+        if(!hccapx_serializer_get(i, &hccapx)){
+            break;
+        }
+        esp_err_t err = httpd_resp_send_chunk(req, (const char *) &hccapx, sizeof(hccapx_t));
+        if(err != ESP_OK){
+            ESP_LOGE(TAG, "Error sending HCCAPX record");
+            return err;
+        }
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
 static httpd_uri_t uri_capture_hccapx_get = {
@@ -400,11 +713,111 @@ static httpd_uri_t uri_capture_hccapx_get = {
 };
 //@}
 
+/**
+ * @brief Handlers for \c /capture.hc22000 endpoint
+ *
+ * This endpoint provides PMKIDs and handshakes in hashcat 22000 text format from hc22000_serializer, one hash per line.
+ *
+ * @note Most browsers will start download process when this endpoint is called.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_capture_hc22000_get_handler(httpd_req_t *req){
+    // all handlers run in single httpd task, so the line buffer doesn't have to be on its stack
+    static char line[HC22000_SERIALIZER_MAX_LINE_SIZE];
+    ESP_LOGD(TAG, "Providing HC22000 file...");
+    unsigned count = hc22000_serializer_get_count();
+    if(count == 0){
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No PMKID or complete handshake captured");
+    }
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    for(unsigned i = 0; i < count; i++){
+        unsigned length = hc22000_serializer_get_line(i, line, sizeof(line));
+        if(length == 0){
+            break;
+        }
+        esp_err_t err = httpd_resp_send_chunk(req, line, length);
+        if(err != ESP_OK){
+            ESP_LOGE(TAG, "Error sending HC22000 line");
+            return err;
+        }
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_capture_hc22000_get = {
+    .uri = "/capture.hc22000",
+    .method = HTTP_GET,
+    .handler = uri_capture_hc22000_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /metrics endpoint
+ *
+ * This endpoint provides capture pipeline metrics in Prometheus text format.
+ *
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_metrics_get_handler(httpd_req_t *req){
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "text/plain; version=0.0.4"));
+    esp_err_t err = metrics_render(&resp_chunk_write, req);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Error sending metrics");
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_metrics_get = {
+    .uri = "/metrics",
+    .method = HTTP_GET,
+    .handler = uri_metrics_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /logs endpoint
+ *
+ * This endpoint provides the most recent log output kept in log ring as plain text.
+ *
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_logs_get_handler(httpd_req_t *req){
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "text/plain"));
+    esp_err_t err = log_buffer_read(&resp_chunk_write, req);
+    if(err == ESP_ERR_INVALID_STATE){
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Log buffer not running");
+    }
+    if(err != ESP_OK){
+        // not logged, it would land in the ring being sent
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_logs_get = {
+    .uri = "/logs",
+    .method = HTTP_GET,
+    .handler = uri_logs_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
 void webserver_run(){
     ESP_LOGD(TAG, "Running webserver");
+    boot_id = esp_random();
 
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    httpd_handle_t server = NULL;
+    // default limit of 8 handlers is not enough for all endpoints
+    config.max_uri_handlers = 12;
 
     ESP_ERROR_CHECK(httpd_start(&server, &config));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_root_get));
@@ -412,6 +825,17 @@ void webserver_run(){
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_ap_list_get));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_run_attack_post));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_status_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_status_ws));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_pcap_get));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_hccapx_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_hc22000_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_metrics_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_logs_get));
+
+    const esp_timer_create_args_t status_push_timer_args = {
+        .callback = &status_push_timer_callback,
+        .name = "status_push"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&status_push_timer_args, &status_push_timer));
+    ESP_ERROR_CHECK(esp_event_handler_register(ATTACK_EVENTS, ATTACK_EVENT_STATUS_CHANGED, &attack_status_changed_handler, NULL));
 }
\ No newline at end of file
@@ -5,25 +5,191 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Implements AP scanning functionality.
+ * 
+ * Results of every scan are merged into cache by BSSID. Background passive scan is started by periodic timer 
+ * and its results are merged in WIFI_EVENT_SCAN_DONE handler. Blocking scan merges its results directly.
+ * Cache is protected by mutex, users get only copies of records. Starting of scans is serialised by another mutex,
+ * so background scan is never started while blocking scan is in progress.
  */
 #include "ap_scanner.h"
 
+#include <stdatomic.h>
+#include <string.h>
+
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
+#include "esp_event.h"
+#include "esp_timer.h"
 #include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+/**
+ * @brief Weight of previous RSSI in smoothing, new RSSI has weight 1
+ */
+#define RSSI_SMOOTHING_WEIGHT 3
 
 static const char* TAG = "wifi_controller/ap_scanner";
 /**
- * @brief Stores last scanned AP records into linked list.
- * 
+ * @brief Cache of scanned AP records.
  */
 static wifictl_ap_records_t ap_records;
+static SemaphoreHandle_t ap_records_mutex = NULL;
+/**
+ * @brief Result of single scan, used only while holding ap_records_mutex
+ */
+static wifi_ap_record_t scan_result[CONFIG_SCAN_MAX_AP];
+/**
+ * @brief Held by blocking scan for its whole duration and by timer while it starts background scan
+ */
+static SemaphoreHandle_t scan_start_mutex = NULL;
+static esp_timer_handle_t refresh_timer;
+static atomic_bool background_scan_running = false;
+static atomic_bool background_scan_paused = false;
+
+static int find_ap_record(const uint8_t *bssid){
+    for(unsigned i = 0; i < ap_records.count; i++){
+        if(memcmp(ap_records.records[i].bssid, bssid, 6) == 0){
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Removes APs that were not seen for CONFIG_SCAN_CACHE_EXPIRY seconds. Order of other records is kept.
+ */
+static void expire_ap_records(int64_t now){
+    unsigned kept = 0;
+    for(unsigned i = 0; i < ap_records.count; i++){
+        if(now - ap_records.last_seen[i] > (int64_t) CONFIG_SCAN_CACHE_EXPIRY * 1000000){
+            ESP_LOGV(TAG, "AP %s expired", ap_records.records[i].ssid);
+            continue;
+        }
+        if(kept != i){
+            ap_records.records[kept] = ap_records.records[i];
+            ap_records.last_seen[kept] = ap_records.last_seen[i];
+        }
+        kept++;
+    }
+    ap_records.count = kept;
+}
+
+/**
+ * @brief Takes records of finished scan from Wi-Fi driver and merges them into cache.
+ * 
+ * Known APs are updated and their RSSI is smoothed, new APs are appended. If the cache is full, 
+ * new AP replaces the one that wasn't seen for the longest time.
+ */
+static void merge_scan_result(){
+    xSemaphoreTake(ap_records_mutex, portMAX_DELAY);
+    uint16_t count = CONFIG_SCAN_MAX_AP;
+    if(esp_wifi_scan_get_ap_records(&count, scan_result) != ESP_OK){
+        ESP_LOGW(TAG, "No scan result");
+        xSemaphoreGive(ap_records_mutex);
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    for(unsigned i = 0; i < count; i++){
+        int index = find_ap_record(scan_result[i].bssid);
+        if(index >= 0){
+            int rssi = ap_records.records[index].rssi;
+            ap_records.records[index] = scan_result[i];
+            ap_records.records[index].rssi = (rssi * RSSI_SMOOTHING_WEIGHT + scan_result[i].rssi) / (RSSI_SMOOTHING_WEIGHT + 1);
+        }
+        else {
+            if(ap_records.count < CONFIG_SCAN_MAX_AP){
+                index = ap_records.count++;
+            }
+            else {
+                index = 0;
+                for(unsigned j = 1; j < ap_records.count; j++){
+                    if(ap_records.last_seen[j] < ap_records.last_seen[index]){
+                        index = j;
+                    }
+                }
+            }
+            ap_records.records[index] = scan_result[i];
+        }
+        ap_records.last_seen[index] = now;
+    }
+    expire_ap_records(now);
+    ap_records.updated = now;
+    ESP_LOGI(TAG, "Found %u APs, %u cached.", count, ap_records.count);
+    xSemaphoreGive(ap_records_mutex);
+}
+
+/**
+ * @brief Aborts background scan if it's running. Its results are discarded.
+ */
+static void abort_background_scan(){
+    if(atomic_exchange(&background_scan_running, false)){
+        esp_wifi_scan_stop();
+    }
+}
+
+static void scan_done_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data){
+    // blocking scan merges its result by itself
+    if(!atomic_exchange(&background_scan_running, false)){
+        return;
+    }
+    const wifi_event_sta_scan_done_t *scan_done = (const wifi_event_sta_scan_done_t *) event_data;
+    if(scan_done->status != 0){
+        ESP_LOGW(TAG, "Background scan failed");
+        return;
+    }
+    merge_scan_result();
+}
+
+static void refresh_timer_callback(void *arg){
+    // don't wait for blocking scan, it refreshes the cache anyway
+    if(xSemaphoreTake(scan_start_mutex, 0) != pdTRUE){
+        return;
+    }
+    if(atomic_load(&background_scan_paused) || atomic_load(&background_scan_running)){
+        xSemaphoreGive(scan_start_mutex);
+        return;
+    }
+    wifi_scan_config_t scan_config = {
+        .ssid = NULL,
+        .bssid = NULL,
+        .channel = 0,
+        .scan_type = WIFI_SCAN_TYPE_PASSIVE,
+        .scan_time.passive = CONFIG_SCAN_PASSIVE_TIME,
+        .show_hidden = true
+    };
+    atomic_store(&background_scan_running, true);
+    esp_err_t err = esp_wifi_scan_start(&scan_config, false);
+    if(err != ESP_OK){
+        atomic_store(&background_scan_running, false);
+        ESP_LOGW(TAG, "Background scan not started: %s", esp_err_to_name(err));
+    }
+    xSemaphoreGive(scan_start_mutex);
+}
+
+void wifictl_scan_init(){
+    ap_records_mutex = xSemaphoreCreateMutex();
+    scan_start_mutex = xSemaphoreCreateMutex();
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_SCAN_DONE, &scan_done_handler, NULL));
+    if(CONFIG_SCAN_REFRESH_INTERVAL == 0){
+        ESP_LOGI(TAG, "Background scan disabled");
+        return;
+    }
+    const esp_timer_create_args_t refresh_timer_args = {
+        .callback = &refresh_timer_callback,
+        .name = "ap_scan_refresh"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&refresh_timer_args, &refresh_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(refresh_timer, (uint64_t) CONFIG_SCAN_REFRESH_INTERVAL * 1000000));
+    // fill the cache right away
+    refresh_timer_callback(NULL);
+}
 
 void wifictl_scan_nearby_aps(){
     ESP_LOGD(TAG, "Scanning nearby APs...");
-
-    ap_records.count = CONFIG_SCAN_MAX_AP;
+    xSemaphoreTake(scan_start_mutex, portMAX_DELAY);
+    abort_background_scan();
 
     wifi_scan_config_t scan_config = {
         .ssid = NULL,
@@ -33,22 +199,55 @@ void wifictl_scan_nearby_aps(){
         .show_hidden = true
     };
     
-    ESP_ERROR_CHECK(esp_wifi_scan_start(&scan_config, true));
-    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&ap_records.count, ap_records.records));
-    ESP_LOGI(TAG, "Found %u APs.", ap_records.count);
+    esp_err_t err = esp_wifi_scan_start(&scan_config, true);
+    if(err != ESP_OK){
+        // cached records are kept
+        ESP_LOGE(TAG, "Scan failed: %s", esp_err_to_name(err));
+        xSemaphoreGive(scan_start_mutex);
+        return;
+    }
+    merge_scan_result();
+    xSemaphoreGive(scan_start_mutex);
     ESP_LOGD(TAG, "Scan done.");
 }
 
-const wifictl_ap_records_t *wifictl_get_ap_records() {
-    return &ap_records;
+void wifictl_scan_background_pause(){
+    // timer can't be just starting background scan it checked pause for
+    xSemaphoreTake(scan_start_mutex, portMAX_DELAY);
+    atomic_store(&background_scan_paused, true);
+    abort_background_scan();
+    xSemaphoreGive(scan_start_mutex);
+}
+
+void wifictl_scan_background_resume(){
+    atomic_store(&background_scan_paused, false);
 }
 
-const wifi_ap_record_t *wifictl_get_ap_record(unsigned index) {
-    if(index > ap_records.count){
+void wifictl_get_ap_records(wifictl_ap_records_t *records) {
+    xSemaphoreTake(ap_records_mutex, portMAX_DELAY);
+    *records = ap_records;
+    xSemaphoreGive(ap_records_mutex);
+}
+
+bool wifictl_get_ap_record(unsigned index, wifi_ap_record_t *ap_record) {
+    xSemaphoreTake(ap_records_mutex, portMAX_DELAY);
+    bool found = index < ap_records.count;
+    if(found){
+        *ap_record = ap_records.records[index];
+    }
+    else {
         ESP_LOGE(TAG, "Index out of bounds! %u records available, but %u requested", ap_records.count, index);
-        return NULL;
     }
-    ESP_LOGI(TAG, "Successfully retrieved AP record at index %u", index);
-    ESP_LOGI(TAG, "Address of AP record at index %u: %p", index, (void *)&ap_records.records[index]);
-    return &ap_records.records[index];
-}
\ No newline at end of file
+    xSemaphoreGive(ap_records_mutex);
+    return found;
+}
+
+bool wifictl_find_ap_record(const uint8_t *bssid, wifi_ap_record_t *ap_record) {
+    xSemaphoreTake(ap_records_mutex, portMAX_DELAY);
+    int index = find_ap_record(bssid);
+    if(index >= 0){
+        *ap_record = ap_records.records[index];
+    }
+    xSemaphoreGive(ap_records_mutex);
+    return index >= 0;
+}
@@ -5,40 +5,82 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Provides an interface for AP scanning functionality.
+ * 
+ * Scanned APs are kept in cache that is refreshed by periodic background passive scan, 
+ * so users get AP records immediately without waiting for blocking scan.
  */
 #ifndef AP_SCANNER_H
 #define AP_SCANNER_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "esp_wifi_types.h"
 
 /**
- * @brief Linked list of wifi_ap_record_t records.
+ * @brief Cached AP records.
  * 
+ * APs are identified by BSSID. RSSI of every record is smoothed over scans.
+ * APs not seen for CONFIG_SCAN_CACHE_EXPIRY seconds are removed, so indexes of records may change after every scan.
  */
 typedef struct {
     uint16_t count;
+    int64_t updated;                            ///< esp_timer time of last finished scan, 0 if there was no scan yet
+    int64_t last_seen[CONFIG_SCAN_MAX_AP];      ///< esp_timer time of last scan that found the AP
     wifi_ap_record_t records[CONFIG_SCAN_MAX_AP];
 } wifictl_ap_records_t;
 
 /**
- * @brief Switches ESP into scanning mode and stores result.
+ * @brief Creates AP cache and starts periodic background scan.
  * 
+ * @attention Wi-Fi has to be started. This function should be called only once.
+ */
+void wifictl_scan_init();
+
+/**
+ * @brief Switches ESP into active scanning mode, waits for result and merges it into cache.
+ * 
+ * Running background scan is aborted. It takes few seconds and clients of management AP may be disconnected.
  */
 void wifictl_scan_nearby_aps();
 
 /**
- * @brief Returns current list of scanned APs.
+ * @brief Stops background scans, e.g. while attack uses radio on single channel.
  * 
- * @return const wifictl_ap_records_t* 
+ * Running background scan is aborted.
+ */
+void wifictl_scan_background_pause();
+
+/**
+ * @brief Allows background scans again.
  */
-const wifictl_ap_records_t *wifictl_get_ap_records();
+void wifictl_scan_background_resume();
 
 /**
- * @brief Returns AP record on given index
+ * @brief Copies current cache of scanned APs.
+ * 
+ * @param ap_records 
+ */
+void wifictl_get_ap_records(wifictl_ap_records_t *ap_records);
+
+/**
+ * @brief Copies AP record on given index of the cache
  * 
  * @param index 
- * @return const wifi_ap_record_t* 
+ * @param ap_record 
+ * @return true if record exists
+ * @return false if index is out of bounds
+ */
+bool wifictl_get_ap_record(unsigned index, wifi_ap_record_t *ap_record);
+
+/**
+ * @brief Copies AP record with given BSSID from the cache
+ * 
+ * @param bssid 
+ * @param ap_record 
+ * @return true if AP is cached
+ * @return false if AP is not cached
  */
-const wifi_ap_record_t *wifictl_get_ap_record(unsigned index);
+bool wifictl_find_ap_record(const uint8_t *bssid, wifi_ap_record_t *ap_record);
 
-#endif
\ No newline at end of file
+#endif
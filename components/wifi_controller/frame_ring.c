@@ -0,0 +1,92 @@
+/**
+ * @file frame_ring.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements lock-free single-producer/single-consumer frame ring.
+ */
+#include "frame_ring.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "alloc_policy.h"
+
+/**
+ * @brief Returns pointer to slot on given position.
+ *
+ * @param ring
+ * @param position free running index, wrapped by slot mask
+ * @return frame_ring_slot_t*
+ */
+static inline frame_ring_slot_t *slot_at(frame_ring_t *ring, unsigned position){
+    return (frame_ring_slot_t *) &ring->slots[(position & (ring->slot_count - 1)) * ring->slot_stride];
+}
+
+bool frame_ring_init(frame_ring_t *ring, unsigned slot_count, unsigned slot_data_size){
+    unsigned count = 1;
+    while(count < slot_count){
+        count <<= 1;
+    }
+    ring->slot_count = count;
+    ring->slot_data_size = (slot_data_size + 3) & ~3u;
+    ring->slot_stride = sizeof(frame_ring_slot_t) + ring->slot_data_size;
+    ring->slots = (uint8_t *) alloc_policy_malloc(ALLOC_POLICY_SUBSYSTEM_SNIFFER, ring->slot_count * ring->slot_stride);
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+    atomic_init(&ring->oversized, 0);
+    return ring->slots != NULL;
+}
+
+void frame_ring_deinit(frame_ring_t *ring){
+    free(ring->slots);
+    ring->slots = NULL;
+}
+
+bool frame_ring_push(frame_ring_t *ring, uint32_t type, uint32_t tag, const void *data, unsigned length){
+    if(length > ring->slot_data_size){
+        atomic_fetch_add_explicit(&ring->oversized, 1, memory_order_relaxed);
+        return false;
+    }
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if(head - tail >= ring->slot_count){
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return false;
+    }
+    frame_ring_slot_t *slot = slot_at(ring, head);
+    slot->type = type;
+    slot->tag = tag;
+    slot->length = length;
+    memcpy(slot->data, data, length);
+    // publish slot content before moving head
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+frame_ring_slot_t *frame_ring_peek(frame_ring_t *ring){
+    return frame_ring_peek_at(ring, 0);
+}
+
+frame_ring_slot_t *frame_ring_peek_at(frame_ring_t *ring, unsigned index){
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if(head - tail <= index){
+        return NULL;
+    }
+    return slot_at(ring, tail + index);
+}
+
+void frame_ring_release(frame_ring_t *ring){
+    frame_ring_release_batch(ring, 1);
+}
+
+void frame_ring_release_batch(frame_ring_t *ring, unsigned count){
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, tail + count, memory_order_release);
+}
+
+unsigned frame_ring_count(frame_ring_t *ring){
+    return atomic_load_explicit(&ring->head, memory_order_acquire) - atomic_load_explicit(&ring->tail, memory_order_acquire);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file frame_ring.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides lock-free single-producer/single-consumer ring of preallocated frame slots.
+ *
+ * Producer (promiscuous callback) never blocks. If there is no free slot, frame is dropped and counted.
+ * Consumer (sniffer task) reads slots in place and releases them after processing.
+ */
+#ifndef FRAME_RING_H
+#define FRAME_RING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Single slot of the ring.
+ *
+ * Data are stored word aligned, so they can be casted directly to wifi_promiscuous_pkt_t.
+ */
+typedef struct {
+    uint32_t type;      ///< wifi_promiscuous_pkt_type_t of stored frame
+    uint32_t tag;       ///< producer defined value stored alongside data
+    uint32_t length;    ///< number of valid bytes in data
+    uint32_t data[];
+} frame_ring_slot_t;
+
+/**
+ * @brief Ring state.
+ *
+ * head is written only by producer, tail only by consumer.
+ */
+typedef struct {
+    uint8_t *slots;
+    unsigned slot_count;        ///< power of two
+    unsigned slot_data_size;    ///< capacity of frame_ring_slot_t.data in bytes
+    unsigned slot_stride;
+    atomic_uint head;
+    atomic_uint tail;
+    atomic_uint dropped;        ///< frames dropped because ring was full
+    atomic_uint oversized;      ///< frames dropped because they didn't fit into slot
+} frame_ring_t;
+
+/**
+ * @brief Allocates slots for the ring.
+ *
+ * @param ring
+ * @param slot_count number of slots, rounded up to power of two
+ * @param slot_data_size maximum size of single stored frame in bytes
+ * @return true on success
+ * @return false if allocation failed
+ */
+bool frame_ring_init(frame_ring_t *ring, unsigned slot_count, unsigned slot_data_size);
+
+/**
+ * @brief Frees ring slots.
+ *
+ * @attention Neither producer nor consumer may use the ring anymore.
+ * @param ring
+ */
+void frame_ring_deinit(frame_ring_t *ring);
+
+/**
+ * @brief Copies frame into next free slot. Never blocks.
+ *
+ * @attention Has to be called only from single producer context.
+ * @param ring
+ * @param type frame type stored alongside data
+ * @param tag producer defined value stored alongside data
+ * @param data frame data
+ * @param length size of data in bytes
+ * @return true if frame was stored
+ * @return false if frame was dropped (ring full or frame too big)
+ */
+bool frame_ring_push(frame_ring_t *ring, uint32_t type, uint32_t tag, const void *data, unsigned length);
+
+/**
+ * @brief Returns oldest stored slot without removing it.
+ *
+ * @attention Has to be called only from single consumer context.
+ * @param ring
+ * @return frame_ring_slot_t* oldest slot
+ * @return \c NULL if ring is empty
+ */
+frame_ring_slot_t *frame_ring_peek(frame_ring_t *ring);
+
+/**
+ * @brief Returns stored slot on given position from the oldest one without removing it.
+ *
+ * @attention Has to be called only from single consumer context.
+ * @param ring
+ * @param index 0 for the oldest slot
+ * @return frame_ring_slot_t* slot
+ * @return \c NULL if ring holds less than index + 1 slots
+ */
+frame_ring_slot_t *frame_ring_peek_at(frame_ring_t *ring, unsigned index);
+
+/**
+ * @brief Releases oldest slot returned by frame_ring_peek() back to producer.
+ *
+ * @param ring
+ */
+void frame_ring_release(frame_ring_t *ring);
+
+/**
+ * @brief Releases given number of oldest slots back to producer at once.
+ *
+ * @param ring
+ * @param count number of slots, at most frame_ring_count()
+ */
+void frame_ring_release_batch(frame_ring_t *ring, unsigned count);
+
+/**
+ * @brief Returns number of slots currently occupied.
+ *
+ * @param ring
+ * @return unsigned
+ */
+unsigned frame_ring_count(frame_ring_t *ring);
+
+#endif
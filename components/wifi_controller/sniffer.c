@@ -5,52 +5,118 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Implements sniffer logic.
+ * 
+ * Promiscuous callback and sniffer task drive platform independent sniffer pipeline (sniffer_pipeline.c).
  */
 #include "sniffer.h"
 
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#define LOG_LOCAL_LEVEL CONFIG_SNIFFER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
-#include "esp_event.h"
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "sniffer_pipeline.h"
 
 static const char *TAG = "sniffer"; 
 
-ESP_EVENT_DEFINE_BASE(SNIFFER_EVENTS);
+#if CONFIG_FREERTOS_UNICORE
+#define SNIFFER_TASK_CORE 0
+#else
+#define SNIFFER_TASK_CORE CONFIG_SNIFFER_TASK_CORE
+#endif
+
+static TaskHandle_t sniffer_task_handle = NULL;
 
 /**
  * @brief Callback for promiscuous reciever. 
  * 
- * It forwards captured frames into event pool and sorts them based on their type
- * - Data
- * - Management
- * - Control
+ * Frame is matched against subscriptions and copied into frame ring by the pipeline. Sniffer task is woken up 
+ * only when the ring stops being empty or when full batch is waiting, not for every frame.
+ * It never blocks Wi-Fi driver.
  * 
  * @param buf 
  * @param type 
  */
 static void frame_handler(void *buf, wifi_promiscuous_pkt_type_t type) {
-    ESP_LOGV(TAG, "Captured frame %d.", (int) type);
-
-    wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) buf;
-
-    int32_t event_id;
-    switch (type) {
-        case WIFI_PKT_DATA:
-            event_id = SNIFFER_EVENT_CAPTURED_DATA;
-            break;
-        case WIFI_PKT_MGMT:
-            event_id = SNIFFER_EVENT_CAPTURED_MGMT;
-            break;
-        case WIFI_PKT_CTRL:
-            event_id = SNIFFER_EVENT_CAPTURED_CTRL;
-            break;
-        default:
+    if((type != WIFI_PKT_DATA) && (type != WIFI_PKT_MGMT) && (type != WIFI_PKT_CTRL)){
+        return;
+    }
+    if(sniffer_pipeline_ingest((const wifi_promiscuous_pkt_t *) buf, type)){
+        xTaskNotifyGive(sniffer_task_handle);
+    }
+}
+
+/**
+ * @brief Waits until full batch is in the ring, but at most CONFIG_SNIFFER_BATCH_LATENCY since first frame arrived.
+ */
+static void wait_for_batch(){
+    const TickType_t latency = pdMS_TO_TICKS(CONFIG_SNIFFER_BATCH_LATENCY);
+    const TickType_t start = xTaskGetTickCount();
+    while(sniffer_pipeline_pending() < CONFIG_SNIFFER_BATCH_SIZE){
+        TickType_t waited = xTaskGetTickCount() - start;
+        if(waited >= latency){
             return;
+        }
+        ulTaskNotifyTake(pdTRUE, latency - waited);
+    }
+}
+
+/**
+ * @brief Sniffer task that drains frame ring.
+ * 
+ * It passes captured frames directly to subscriptions that matched them in promiscuous callback.
+ * Frames are borrowed from the ring, they are not copied again.
+ * 
+ * After the first frame wakes it up, it waits for full batch (CONFIG_SNIFFER_BATCH_SIZE) or until 
+ * CONFIG_SNIFFER_BATCH_LATENCY expires. Then it dispatches the ring in batches until it's empty.
+ * Subscribers parse and serialize frames directly in this task, which is pinned to CONFIG_SNIFFER_TASK_CORE.
+ * Slow subscriber only fills the ring, it doesn't stall the radio.
+ * 
+ * @param args not used
+ */
+static void sniffer_task(void *args) {
+    for(;;){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        wait_for_batch();
+        while(sniffer_pipeline_dispatch_batch() > 0){
+        }
+    }
+}
+
+/**
+ * @brief Initialises sniffer pipeline and creates sniffer task on first use.
+ */
+static void sniffer_init(){
+    if(sniffer_task_handle != NULL){
+        return;
     }
+    ESP_ERROR_CHECK(sniffer_pipeline_init());
+    // pinned away from PRO_CPU where Wi-Fi stack, event loop and httpd run by default
+    if(xTaskCreatePinnedToCore(&sniffer_task, "sniffer", CONFIG_SNIFFER_TASK_STACK_SIZE, NULL, CONFIG_SNIFFER_TASK_PRIORITY, &sniffer_task_handle, SNIFFER_TASK_CORE) != pdPASS){
+        ESP_LOGE(TAG, "Error creating sniffer task!");
+        ESP_ERROR_CHECK(ESP_ERR_NO_MEM);
+    }
+}
 
-    ESP_ERROR_CHECK(esp_event_post(SNIFFER_EVENTS, event_id, frame, frame->rx_ctrl.sig_len + sizeof(wifi_promiscuous_pkt_t), portMAX_DELAY));
+esp_err_t wifictl_sniffer_subscribe(const sniffer_match_t *match, sniffer_frame_cb_t callback, sniffer_batch_end_cb_t batch_end, void *args, sniffer_subscription_t *subscription){
+    sniffer_init();
+    return sniffer_pipeline_subscribe(match, callback, batch_end, args, subscription);
+}
+
+void wifictl_sniffer_unsubscribe(sniffer_subscription_t subscription){
+    sniffer_pipeline_unsubscribe(subscription);
+}
+
+esp_err_t wifictl_sniffer_get_filter_stats(sniffer_subscription_t subscription, sniffer_filter_stats_t *stats){
+    return sniffer_pipeline_get_filter_stats(subscription, stats);
+}
+
+void wifictl_sniffer_inject(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type){
+    sniffer_init();
+    frame_handler((void *) frame, type);
 }
 
 /**
@@ -72,6 +138,7 @@ void wifictl_sniffer_filter_frame_types(bool data, bool mgmt, bool ctrl) {
 
 void wifictl_sniffer_start(uint8_t channel) {
     ESP_LOGI(TAG, "Starting promiscuous mode...");
+    sniffer_init();
     // ESP32 cannot switch port, if there is some STA connected to AP
     ESP_LOGD(TAG, "Kicking all connected STAs from AP");
     ESP_ERROR_CHECK(esp_wifi_deauth_sta(0));
@@ -83,4 +150,13 @@ void wifictl_sniffer_start(uint8_t channel) {
 void wifictl_sniffer_stop() {
     ESP_LOGI(TAG, "Stopping promiscuous mode...");
     esp_wifi_set_promiscuous(false);
+    unsigned dropped, oversized;
+    sniffer_pipeline_get_dropped(&dropped, &oversized);
+    ESP_LOGI(TAG, "Frames dropped: %u (ring full), %u (oversized)", dropped, oversized);
+}
+
+unsigned wifictl_sniffer_get_dropped_count() {
+    unsigned dropped, oversized;
+    sniffer_pipeline_get_dropped(&dropped, &oversized);
+    return dropped + oversized;
 }
\ No newline at end of file
@@ -10,15 +10,120 @@
 #define SNIFFER_H
 
 #include <stdbool.h>
-#include "esp_event.h"
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_wifi_types.h"
 
-ESP_EVENT_DECLARE_BASE(SNIFFER_EVENTS);
+/**
+ * @brief Fields of sniffer_match_t that are compared. Fields not selected by flags match everything.
+ */
+typedef enum {
+    SNIFFER_MATCH_TYPE = (1 << 0),          ///< promiscuous packet type (data, management, control)
+    SNIFFER_MATCH_SUBTYPE = (1 << 1),       ///< 802.11 frame subtype
+    SNIFFER_MATCH_BSSID = (1 << 2),         ///< addr3 of the frame
+    SNIFFER_MATCH_ETHERTYPE = (1 << 3)      ///< ethertype in LLC/SNAP header of unprotected data frame
+} sniffer_match_flags_t;
+
+/**
+ * @brief Match predicate of sniffer subscription.
+ */
+typedef struct {
+    uint32_t flags;                         ///< combination of sniffer_match_flags_t
+    wifi_promiscuous_pkt_type_t type;
+    uint8_t subtype;
+    uint8_t bssid[6];
+    uint16_t ethertype;                     ///< in host byte order
+} sniffer_match_t;
 
-enum {
-    SNIFFER_EVENT_CAPTURED_DATA,
-    SNIFFER_EVENT_CAPTURED_MGMT,
-    SNIFFER_EVENT_CAPTURED_CTRL
-};
+/**
+ * @brief Callback of sniffer subscription.
+ * 
+ * It's called from sniffer task for each captured frame that matches subscription predicate.
+ * Frame is borrowed and valid until batch end callback of the subscription returns (see sniffer_batch_end_cb_t), 
+ * or only until this callback returns if subscription has no batch end callback. It must not be modified, because
+ * the same frame may be passed to multiple subscribers.
+ * 
+ * @param frame captured frame
+ * @param type promiscuous packet type of the frame
+ * @param args user argument given on subscription
+ */
+typedef void (*sniffer_frame_cb_t)(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type, void *args);
+
+/**
+ * @brief Batch end callback of sniffer subscription.
+ * 
+ * Sniffer task dispatches frames in batches of up to CONFIG_SNIFFER_BATCH_SIZE frames. This callback is called 
+ * after the last frame of the batch that matched subscription, so subscriber can process frames of the whole batch at once.
+ * Frames passed to frame callback during the batch are released after it returns.
+ * 
+ * @param args user argument given on subscription
+ */
+typedef void (*sniffer_batch_end_cb_t)(void *args);
+
+/**
+ * @brief Handle of sniffer subscription.
+ */
+typedef unsigned sniffer_subscription_t;
+
+/**
+ * @brief Counters of subscription filter.
+ */
+typedef struct {
+    unsigned hits;      ///< frames accepted by filter
+    unsigned misses;    ///< frames rejected by filter in promiscuous callback
+} sniffer_filter_stats_t;
+
+/**
+ * @brief Subscribes consumer to captured frames matching given predicate.
+ * 
+ * Predicate is compiled and evaluated directly in promiscuous callback, so frames that don't match any subscription
+ * are discarded without being copied.
+ * 
+ * @param match predicate, copied into subscription
+ * @param callback called for every matching frame
+ * @param batch_end called after every batch with matching frames, can be \c NULL
+ * @param args passed to callbacks
+ * @param subscription handle of created subscription
+ * @return esp_err_t 
+ * @return ESP_ERR_NO_MEM if all CONFIG_SNIFFER_MAX_SUBSCRIBERS subscriptions are used
+ */
+esp_err_t wifictl_sniffer_subscribe(const sniffer_match_t *match, sniffer_frame_cb_t callback, sniffer_batch_end_cb_t batch_end, void *args, sniffer_subscription_t *subscription);
+
+/**
+ * @brief Cancels subscription.
+ * 
+ * When this function returns, callback of the subscription is not running and won't be called again.
+ * It may be called from subscription callback itself.
+ * 
+ * @param subscription 
+ */
+void wifictl_sniffer_unsubscribe(sniffer_subscription_t subscription);
+
+/**
+ * @brief Returns hit/miss counters of subscription filter.
+ * 
+ * Counters are reset on subscription and kept after it's cancelled, until the handle is reused.
+ * 
+ * @param subscription 
+ * @param stats 
+ * @return esp_err_t 
+ * @return ESP_ERR_INVALID_ARG if handle is not valid
+ */
+esp_err_t wifictl_sniffer_get_filter_stats(sniffer_subscription_t subscription, sniffer_filter_stats_t *stats);
+
+/**
+ * @brief Passes frame to sniffer as if it was received by promiscuous callback.
+ * 
+ * Frame goes through subscription filters, frame ring and sniffer task like captured frame,
+ * so recorded captures can be replayed through the whole capture pipeline (see capture_replay component).
+ * Frame is copied, it can be reused when this function returns.
+ * 
+ * @attention Frame ring has single producer, so it must not be called while promiscuous mode runs
+ * and only from one task at a time.
+ * @param frame frame with rx_ctrl filled in, at least sig_len
+ * @param type promiscuous packet type of the frame
+ */
+void wifictl_sniffer_inject(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type);
 
 /**
  * @brief Sets sniffer filter for specific frame types. 
@@ -42,4 +147,14 @@ void wifictl_sniffer_start(uint8_t channel);
  */
 void wifictl_sniffer_stop();
 
+/**
+ * @brief Returns number of captured frames that were dropped before processing
+ * 
+ * Frames are dropped when sniffer task doesn't keep up with the radio and frame ring is full,
+ * or when frame is bigger than CONFIG_SNIFFER_MAX_FRAME_SIZE.
+ * 
+ * @return unsigned 
+ */
+unsigned wifictl_sniffer_get_dropped_count();
+
 #endif
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * @file sniffer_filter.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements precompiled match predicates.
+ */
+#include "sniffer_filter.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Offsets in 802.11 frame used by filters
+ */
+//@{
+#define FRAME_CONTROL_TYPE_MASK 0x0c
+#define FRAME_CONTROL_TYPE_DATA 0x08
+#define FRAME_CONTROL_SUBTYPE_QOS 0x80
+#define FRAME_CONTROL_DS_MASK 0x03
+#define FRAME_CONTROL_DS_WDS 0x03
+#define FRAME_CONTROL_PROTECTED 0x40
+#define FRAME_CONTROL_ORDER 0x80
+#define FRAME_ADDR3_OFFSET 16
+#define DATA_FRAME_HEADER_SIZE 24
+#define ADDR4_SIZE 6
+#define QOS_CONTROL_SIZE 2
+#define HT_CONTROL_SIZE 4
+#define LLC_SNAP_HEADER_SIZE 6
+//@}
+
+// addr3 and ethertype are copied by fixed size memcpy, which compiles into single loads from word aligned payload
+_Static_assert(offsetof(wifi_promiscuous_pkt_t, payload) % 4 == 0, "payload must be word aligned");
+_Static_assert(FRAME_ADDR3_OFFSET % 4 == 0, "addr3 must be word aligned");
+
+/**
+ * @brief Returns offset of ethertype in unprotected data frame, the same way frame analyzer parser does.
+ *
+ * 4-address frames carry addr4, QoS frames carry QoS control and with Order bit set also HT control.
+ *
+ * @param payload data frame of at least DATA_FRAME_HEADER_SIZE bytes
+ * @return unsigned
+ */
+static unsigned get_ethertype_offset(const uint8_t *payload){
+    unsigned offset = DATA_FRAME_HEADER_SIZE;
+    if((payload[1] & FRAME_CONTROL_DS_MASK) == FRAME_CONTROL_DS_WDS){
+        offset += ADDR4_SIZE;
+    }
+    if(payload[0] & FRAME_CONTROL_SUBTYPE_QOS){
+        offset += QOS_CONTROL_SIZE;
+        if(payload[1] & FRAME_CONTROL_ORDER){
+            offset += HT_CONTROL_SIZE;
+        }
+    }
+    return offset + LLC_SNAP_HEADER_SIZE;
+}
+
+void sniffer_filter_compile(sniffer_filter_t *filter, const sniffer_match_t *match){
+    filter->flags = match->flags;
+    filter->type = match->type;
+    filter->subtype = match->subtype;
+    memcpy(&filter->bssid_head, &match->bssid[0], 4);
+    memcpy(&filter->bssid_tail, &match->bssid[4], 2);
+    uint8_t ethertype[2] = { match->ethertype >> 8, match->ethertype & 0xff };
+    memcpy(&filter->ethertype, ethertype, 2);
+    atomic_init(&filter->hits, 0);
+    atomic_init(&filter->misses, 0);
+}
+
+/**
+ * @brief Evaluates filter without counting.
+ *
+ * Cheapest checks go first, so most of the traffic is rejected after single load.
+ */
+static bool is_frame_matching(const sniffer_filter_t *filter, const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type){
+    const uint8_t *payload = frame->payload;
+    unsigned length = frame->rx_ctrl.sig_len;
+    uint32_t flags = filter->flags;
+    if((flags & SNIFFER_MATCH_TYPE) && (type != filter->type)){
+        return false;
+    }
+    if((flags & SNIFFER_MATCH_SUBTYPE) && ((length < 1) || ((payload[0] >> 4) != filter->subtype))){
+        return false;
+    }
+    if(flags & SNIFFER_MATCH_BSSID){
+        if(length < FRAME_ADDR3_OFFSET + 6){
+            return false;
+        }
+        uint32_t bssid_head;
+        uint16_t bssid_tail;
+        memcpy(&bssid_head, &payload[FRAME_ADDR3_OFFSET], 4);
+        memcpy(&bssid_tail, &payload[FRAME_ADDR3_OFFSET + 4], 2);
+        if((bssid_head != filter->bssid_head) || (bssid_tail != filter->bssid_tail)){
+            return false;
+        }
+    }
+    if(flags & SNIFFER_MATCH_ETHERTYPE){
+        if((length < DATA_FRAME_HEADER_SIZE)
+            || ((payload[0] & FRAME_CONTROL_TYPE_MASK) != FRAME_CONTROL_TYPE_DATA)
+            || (payload[1] & FRAME_CONTROL_PROTECTED)){
+            return false;
+        }
+        unsigned offset = get_ethertype_offset(payload);
+        if(length < offset + 2){
+            return false;
+        }
+        uint16_t ethertype;
+        memcpy(&ethertype, &payload[offset], 2);
+        if(ethertype != filter->ethertype){
+            return false;
+        }
+    }
+    return true;
+}
+
+bool sniffer_filter_match(sniffer_filter_t *filter, const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type){
+    if(is_frame_matching(filter, frame, type)){
+        atomic_fetch_add_explicit(&filter->hits, 1, memory_order_relaxed);
+        return true;
+    }
+    atomic_fetch_add_explicit(&filter->misses, 1, memory_order_relaxed);
+    return false;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file sniffer_filter.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides precompiled match predicates evaluated in promiscuous callback.
+ *
+ * Match predicate is compiled into values that are compared with captured frame by single word loads -
+ * addr3 as one 32-bit and one 16-bit load, ethertype as one 16-bit load at offset given by frame control flags.
+ * Each filter counts frames it accepted and rejected.
+ */
+#ifndef SNIFFER_FILTER_H
+#define SNIFFER_FILTER_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_wifi_types.h"
+#include "sniffer.h"
+
+/**
+ * @brief Compiled match predicate.
+ *
+ * Compared values are stored in the same byte order in which they are loaded from the frame.
+ */
+typedef struct {
+    uint32_t flags;             ///< combination of sniffer_match_flags_t
+    uint32_t type;
+    uint8_t subtype;
+    uint32_t bssid_head;        ///< addr3 bytes 0-3
+    uint16_t bssid_tail;        ///< addr3 bytes 4-5
+    uint16_t ethertype;         ///< ethertype in network byte order
+    atomic_uint hits;           ///< frames accepted by filter
+    atomic_uint misses;         ///< frames rejected by filter
+} sniffer_filter_t;
+
+/**
+ * @brief Compiles match predicate into filter and resets its counters.
+ *
+ * @param filter
+ * @param match
+ */
+void sniffer_filter_compile(sniffer_filter_t *filter, const sniffer_match_t *match);
+
+/**
+ * @brief Evaluates filter on captured frame and counts the result.
+ *
+ * @attention Frame payload has to be word aligned, as it is in buffers passed to promiscuous callback.
+ * @param filter
+ * @param frame
+ * @param type
+ * @return true if frame matches all selected fields
+ */
+bool sniffer_filter_match(sniffer_filter_t *filter, const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type);
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * @file sniffer_pipeline.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements platform independent part of sniffer.
+ */
+#include "sniffer_pipeline.h"
+
+#include <stdatomic.h>
+
+#define LOG_LOCAL_LEVEL CONFIG_SNIFFER_LOG_LEVEL
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "metrics.h"
+#include "frame_ring.h"
+#include "sniffer_filter.h"
+
+// Full batch wakes sniffer task up, so it has to fit into frame ring
+_Static_assert(CONFIG_SNIFFER_BATCH_SIZE <= CONFIG_SNIFFER_RING_SLOTS, "SNIFFER_BATCH_SIZE can't exceed SNIFFER_RING_SLOTS");
+
+/**
+ * @brief Low bits of frame ring tag hold mask of matched subscriptions, high bits hold subscription generation
+ */
+#define SUBSCRIBER_MASK_BITS 16
+_Static_assert(CONFIG_SNIFFER_MAX_SUBSCRIBERS <= SUBSCRIBER_MASK_BITS, "SNIFFER_MAX_SUBSCRIBERS doesn't fit into frame ring tag");
+
+static const char *TAG = "sniffer";
+
+/**
+ * @brief Sniffer subscription.
+ *
+ * Entry is filled before active is set and isn't modified while active,
+ * so producer can read it without locking.
+ */
+typedef struct {
+    atomic_bool active;
+    uint16_t generation;    ///< generation at which subscription started
+    sniffer_filter_t filter;
+    sniffer_frame_cb_t callback;
+    sniffer_batch_end_cb_t batch_end;
+    void *args;
+} subscriber_t;
+
+static subscriber_t subscribers[CONFIG_SNIFFER_MAX_SUBSCRIBERS];
+
+/**
+ * @brief Increased by every subscription and stored with every frame, 
+ * so frames matched for cancelled subscription aren't passed to new subscription in the same slot.
+ */
+static atomic_uint generation = 0;
+
+/**
+ * @brief Held by consumer while dispatching batch of frames and by subscription changes
+ */
+static SemaphoreHandle_t subscribers_mutex = NULL;
+
+/**
+ * @brief Ring of captured frames shared between producer and consumer
+ */
+static frame_ring_t frame_ring;
+
+/**
+ * @brief Gauge of frames waiting in frame ring
+ */
+static unsigned get_ring_depth(){
+    return frame_ring_count(&frame_ring);
+}
+
+esp_err_t sniffer_pipeline_init(){
+    if(subscribers_mutex != NULL){
+        return ESP_OK;
+    }
+    if(!frame_ring_init(&frame_ring, CONFIG_SNIFFER_RING_SLOTS, sizeof(wifi_promiscuous_pkt_t) + CONFIG_SNIFFER_MAX_FRAME_SIZE)){
+        ESP_LOGE(TAG, "Error allocating frame ring!");
+        return ESP_ERR_NO_MEM;
+    }
+    subscribers_mutex = xSemaphoreCreateRecursiveMutex();
+    if(subscribers_mutex == NULL){
+        frame_ring_deinit(&frame_ring);
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_ERROR_CHECK_WITHOUT_ABORT(metrics_register_gauge("sniffer_ring_depth", "Frames waiting in frame ring for sniffer task", &get_ring_depth));
+    return ESP_OK;
+}
+
+bool sniffer_pipeline_ingest(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type){
+    uint32_t start = metrics_histogram_start();
+    metrics_counter_inc(METRICS_SNIFFER_FRAMES_RECEIVED);
+    // loaded before subscriptions, so frame matched by cancelled subscription gets older generation than its successor
+    const uint32_t frame_generation = atomic_load(&generation);
+    uint32_t subscriber_mask = 0;
+    for(unsigned i = 0; i < CONFIG_SNIFFER_MAX_SUBSCRIBERS; i++){
+        if(atomic_load_explicit(&subscribers[i].active, memory_order_acquire) && sniffer_filter_match(&subscribers[i].filter, frame, type)){
+            subscriber_mask |= (1u << i);
+        }
+    }
+    if(subscriber_mask == 0){
+        metrics_histogram_observe(METRICS_HISTOGRAM_SNIFFER_FRAME_HANDLER, start);
+        return false;
+    }
+
+    bool wake = false;
+    metrics_counter_inc(METRICS_SNIFFER_FRAMES_MATCHED);
+    const uint32_t tag = subscriber_mask | (frame_generation << SUBSCRIBER_MASK_BITS);
+    if(frame_ring_push(&frame_ring, type, tag, frame, frame->rx_ctrl.sig_len + sizeof(wifi_promiscuous_pkt_t))){
+        // consumer drains the ring before it waits again without timeout, so first frame always wakes it up
+        unsigned count = frame_ring_count(&frame_ring);
+        wake = (count == 1) || (count == CONFIG_SNIFFER_BATCH_SIZE);
+    }
+    else {
+        metrics_counter_inc(METRICS_SNIFFER_FRAMES_DROPPED);
+    }
+    metrics_histogram_observe(METRICS_HISTOGRAM_SNIFFER_FRAME_HANDLER, start);
+    return wake;
+}
+
+/**
+ * @brief Checks if frame with given ring tag belongs to subscription.
+ * 
+ * Subscription could have been cancelled since the frame was matched, or even replaced by new one in the same slot.
+ * Generations are compared modulo 16 bits, frames waiting in ring never span half of that range.
+ */
+static bool is_subscriber_frame(unsigned index, uint32_t tag){
+    const uint16_t age = (uint16_t) ((tag >> SUBSCRIBER_MASK_BITS) - subscribers[index].generation);
+    return (tag & (1u << index)) && atomic_load(&subscribers[index].active) && (age < 0x8000);
+}
+
+/**
+ * Frames are passed to frame callbacks of matching subscriptions, then batch end callbacks of subscriptions
+ * that got some frame are called. Slots are released together after that, so subscribers can keep
+ * pointers to frames until end of the batch.
+ */
+unsigned sniffer_pipeline_dispatch_batch(){
+    unsigned count = frame_ring_count(&frame_ring);
+    if(count > CONFIG_SNIFFER_BATCH_SIZE){
+        count = CONFIG_SNIFFER_BATCH_SIZE;
+    }
+    if(count == 0){
+        return 0;
+    }
+    uint32_t batch_mask = 0;
+    xSemaphoreTakeRecursive(subscribers_mutex, portMAX_DELAY);
+    for(unsigned f = 0; f < count; f++){
+        const frame_ring_slot_t *slot = frame_ring_peek_at(&frame_ring, f);
+        for(unsigned i = 0; i < CONFIG_SNIFFER_MAX_SUBSCRIBERS; i++){
+            if(is_subscriber_frame(i, slot->tag)){
+                subscribers[i].callback((const wifi_promiscuous_pkt_t *) slot->data, slot->type, subscribers[i].args);
+                batch_mask |= (1u << i);
+            }
+        }
+    }
+    for(unsigned i = 0; i < CONFIG_SNIFFER_MAX_SUBSCRIBERS; i++){
+        if((batch_mask & (1u << i)) && atomic_load(&subscribers[i].active) && (subscribers[i].batch_end != NULL)){
+            subscribers[i].batch_end(subscribers[i].args);
+        }
+    }
+    xSemaphoreGiveRecursive(subscribers_mutex);
+    frame_ring_release_batch(&frame_ring, count);
+    metrics_counter_add(METRICS_SNIFFER_FRAMES_DISPATCHED, count);
+    metrics_size_histogram_observe(METRICS_SIZE_HISTOGRAM_SNIFFER_BATCH, count);
+    return count;
+}
+
+unsigned sniffer_pipeline_pending(){
+    return frame_ring_count(&frame_ring);
+}
+
+void sniffer_pipeline_get_dropped(unsigned *dropped, unsigned *oversized){
+    *dropped = atomic_load(&frame_ring.dropped);
+    *oversized = atomic_load(&frame_ring.oversized);
+}
+
+esp_err_t sniffer_pipeline_subscribe(const sniffer_match_t *match, sniffer_frame_cb_t callback, sniffer_batch_end_cb_t batch_end, void *args, sniffer_subscription_t *subscription){
+    xSemaphoreTakeRecursive(subscribers_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < CONFIG_SNIFFER_MAX_SUBSCRIBERS; i++){
+        if(atomic_load(&subscribers[i].active)){
+            continue;
+        }
+        sniffer_filter_compile(&subscribers[i].filter, match);
+        subscribers[i].callback = callback;
+        subscribers[i].batch_end = batch_end;
+        subscribers[i].args = args;
+        subscribers[i].generation = (uint16_t) (atomic_fetch_add(&generation, 1) + 1);
+        // publish subscription content to producer
+        atomic_store_explicit(&subscribers[i].active, true, memory_order_release);
+        xSemaphoreGiveRecursive(subscribers_mutex);
+        *subscription = i;
+        return ESP_OK;
+    }
+    xSemaphoreGiveRecursive(subscribers_mutex);
+    ESP_LOGE(TAG, "No free sniffer subscription!");
+    return ESP_ERR_NO_MEM;
+}
+
+void sniffer_pipeline_unsubscribe(sniffer_subscription_t subscription){
+    if((subscription >= CONFIG_SNIFFER_MAX_SUBSCRIBERS) || (subscribers_mutex == NULL)){
+        return;
+    }
+    xSemaphoreTakeRecursive(subscribers_mutex, portMAX_DELAY);
+    atomic_store(&subscribers[subscription].active, false);
+    xSemaphoreGiveRecursive(subscribers_mutex);
+    ESP_LOGD(TAG, "Subscription %u filter: %u hits, %u misses", subscription,
+        atomic_load(&subscribers[subscription].filter.hits), atomic_load(&subscribers[subscription].filter.misses));
+}
+
+esp_err_t sniffer_pipeline_get_filter_stats(sniffer_subscription_t subscription, sniffer_filter_stats_t *stats){
+    if(subscription >= CONFIG_SNIFFER_MAX_SUBSCRIBERS){
+        return ESP_ERR_INVALID_ARG;
+    }
+    stats->hits = atomic_load(&subscribers[subscription].filter.hits);
+    stats->misses = atomic_load(&subscribers[subscription].filter.misses);
+    return ESP_OK;
+}
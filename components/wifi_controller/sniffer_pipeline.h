@@ -0,0 +1,77 @@
+/**
+ * @file sniffer_pipeline.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides platform independent part of sniffer - subscriptions, frame ring and batch dispatch.
+ *
+ * Producer (promiscuous callback or replay) passes frames to sniffer_pipeline_ingest(), consumer
+ * (sniffer task or host replay tool) drains them by sniffer_pipeline_dispatch_batch().
+ * Tasks, notifications and Wi-Fi driver are left to the caller, so the pipeline is built on host too.
+ */
+#ifndef SNIFFER_PIPELINE_H
+#define SNIFFER_PIPELINE_H
+
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "esp_wifi_types.h"
+#include "sniffer.h"
+
+/**
+ * @brief Allocates frame ring and subscription mutex on first call.
+ *
+ * @return esp_err_t ESP_ERR_NO_MEM if allocation failed
+ */
+esp_err_t sniffer_pipeline_init();
+
+/**
+ * @brief Matches frame against all subscriptions and copies it into frame ring if some of them matches.
+ *
+ * Never blocks. If the ring is full, frame is dropped and counted.
+ * Has to be called only from single producer context.
+ *
+ * @param frame
+ * @param type
+ * @return true if consumer should be woken up - the ring stopped being empty or full batch is waiting
+ */
+bool sniffer_pipeline_ingest(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type);
+
+/**
+ * @brief Dispatches up to CONFIG_SNIFFER_BATCH_SIZE oldest frames of the ring to matching subscriptions.
+ *
+ * @return unsigned number of dispatched frames, 0 if ring is empty
+ */
+unsigned sniffer_pipeline_dispatch_batch();
+
+/**
+ * @brief Returns number of frames waiting in frame ring.
+ *
+ * @return unsigned
+ */
+unsigned sniffer_pipeline_pending();
+
+/**
+ * @brief Returns frames dropped because the ring was full and because they didn't fit into its slot.
+ *
+ * @param dropped
+ * @param oversized
+ */
+void sniffer_pipeline_get_dropped(unsigned *dropped, unsigned *oversized);
+
+/**
+ * @brief Implements wifictl_sniffer_subscribe() after the pipeline is initialised.
+ */
+esp_err_t sniffer_pipeline_subscribe(const sniffer_match_t *match, sniffer_frame_cb_t callback, sniffer_batch_end_cb_t batch_end, void *args, sniffer_subscription_t *subscription);
+
+/**
+ * @brief Implements wifictl_sniffer_unsubscribe().
+ */
+void sniffer_pipeline_unsubscribe(sniffer_subscription_t subscription);
+
+/**
+ * @brief Implements wifictl_sniffer_get_filter_stats().
+ */
+esp_err_t sniffer_pipeline_get_filter_stats(sniffer_subscription_t subscription, sniffer_filter_stats_t *stats);
+
+#endif
@@ -0,0 +1,35 @@
+/**
+ * @file alloc_counter.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements heap allocation counting by wrapping allocator symbols at link time.
+ */
+#include "alloc_counter.h"
+
+#include <stddef.h>
+
+static uint64_t allocations = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size){
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size){
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size){
+    allocations++;
+    return __real_realloc(ptr, size);
+}
+
+uint64_t alloc_counter_get(){
+    return allocations;
+}
@@ -0,0 +1,22 @@
+/**
+ * @file alloc_counter.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Counts heap allocations done by linked code.
+ *
+ * Binary has to be linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc.
+ */
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <stdint.h>
+
+/**
+ * @brief Returns number of malloc/calloc/realloc calls since program start.
+ *
+ * @return uint64_t
+ */
+uint64_t alloc_counter_get();
+
+#endif
@@ -0,0 +1,228 @@
+/**
+ * @file bench_main.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Replays recorded PCAP files through parsers and serializers and measures their throughput.
+ *
+ * Usage: host_bench [-n iterations] [-v] file.pcap...
+ *
+ * For every stage it reports processed frames per second and heap allocations per frame.
+ * Option -v enables all log messages compiled into components at runtime.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "esp_log.h"
+#include "frame_analyzer_parser.h"
+#include "pcap_serializer.h"
+#include "hccapx_serializer.h"
+
+#include "pcap_reader.h"
+#include "alloc_counter.h"
+
+/**
+ * @brief Frames selected as input of a stage
+ */
+typedef struct {
+    unsigned count;
+    pcap_reader_frame_t **frames;
+} frame_list_t;
+
+/**
+ * @brief Single benchmarked stage of capture pipeline
+ */
+typedef struct {
+    const char *name;
+    const frame_list_t *input;
+    void (*setup)();
+    void (*run)(const pcap_reader_frame_t *frame);
+    void (*teardown)();
+} bench_stage_t;
+
+static frame_list_t data_frames = { 0 };
+static frame_list_t eapolkey_frames = { 0 };
+
+static void frame_list_add(frame_list_t *list, pcap_reader_frame_t *frame){
+    list->frames = realloc(list->frames, (list->count + 1) * sizeof(pcap_reader_frame_t *));
+    list->frames[list->count++] = frame;
+}
+
+static double now_sec(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void run_parse_eapol_packet(const pcap_reader_frame_t *frame){
+    eapol_key_view_t eapol_key;
+    parse_eapol_key_frame((const data_frame_t *) frame->data, frame->length, &eapol_key);
+}
+
+static void run_parse_pmkid(const pcap_reader_frame_t *frame){
+    eapol_key_view_t eapol_key;
+    if(!parse_eapol_key_frame((const data_frame_t *) frame->data, frame->length, &eapol_key)){
+        return;
+    }
+    pmkid_result_t pmkid_result;
+    parse_pmkid(&eapol_key, &pmkid_result);
+}
+
+static void setup_hccapx_serializer(){
+    hccapx_serializer_init((const uint8_t *) "TestNetwork", 11);
+}
+
+static void run_hccapx_serializer_add_frame(const pcap_reader_frame_t *frame){
+    hccapx_serializer_add_frame((const data_frame_t *) frame->data, frame->length);
+}
+
+static void setup_pcap_serializer(){
+    pcap_serializer_init("host_bench");
+}
+
+// OFDM 24 Mbps frame on channel 6
+static const wifi_pkt_rx_ctrl_t bench_rx_ctrl = { .rssi = -50, .rate = 0x9, .noise_floor = -95, .channel = 6 };
+
+static void run_pcap_serializer_append_frame(const pcap_reader_frame_t *frame){
+    pcap_serializer_append_frame(frame->data, frame->length, frame->ts_usec, &bench_rx_ctrl);
+}
+
+static void teardown_pcap_serializer(){
+    pcap_serializer_deinit();
+}
+
+/**
+ * @brief Frames collected into batch of default sniffer batch size
+ */
+static pcap_serializer_frame_t pcap_batch[8];
+static unsigned pcap_batch_count = 0;
+
+static void run_pcap_serializer_append_frames(const pcap_reader_frame_t *frame){
+    pcap_batch[pcap_batch_count++] = (pcap_serializer_frame_t) { frame->data, frame->length, frame->ts_usec, &bench_rx_ctrl };
+    if(pcap_batch_count == sizeof(pcap_batch) / sizeof(pcap_batch[0])){
+        pcap_serializer_append_frames(pcap_batch, pcap_batch_count);
+        pcap_batch_count = 0;
+    }
+}
+
+static void teardown_pcap_serializer_batch(){
+    pcap_serializer_append_frames(pcap_batch, pcap_batch_count);
+    pcap_batch_count = 0;
+    pcap_serializer_deinit();
+}
+
+static const bench_stage_t stages[] = {
+    { "parse_eapol_packet", &data_frames, NULL, run_parse_eapol_packet, NULL },
+    { "parse_pmkid", &eapolkey_frames, NULL, run_parse_pmkid, NULL },
+    { "hccapx_serializer_add_frame", &eapolkey_frames, setup_hccapx_serializer, run_hccapx_serializer_add_frame, NULL },
+    { "pcap_serializer_append_frame", &data_frames, setup_pcap_serializer, run_pcap_serializer_append_frame, teardown_pcap_serializer },
+    { "pcap_serializer_append_frames", &data_frames, setup_pcap_serializer, run_pcap_serializer_append_frames, teardown_pcap_serializer_batch },
+};
+
+/**
+ * @brief Runs single stage and prints its results
+ *
+ * Standard output of the measured code (e.g. debug printf) is discarded during measurement.
+ */
+static void run_stage(const bench_stage_t *stage, unsigned iterations){
+    if(stage->input->count == 0){
+        printf("%-32s %12s\n", stage->name, "no input");
+        return;
+    }
+    // logs are discarded too, with -v measured time includes their formatting but not terminal output
+    fflush(stdout);
+    fflush(stderr);
+    int stdout_fd = dup(STDOUT_FILENO);
+    int stderr_fd = dup(STDERR_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    dup2(null_fd, STDERR_FILENO);
+
+    if(stage->setup){
+        stage->setup();
+    }
+    uint64_t allocations = alloc_counter_get();
+    double start = now_sec();
+    for(unsigned i = 0; i < iterations; i++){
+        for(unsigned f = 0; f < stage->input->count; f++){
+            stage->run(stage->input->frames[f]);
+        }
+    }
+    double elapsed = now_sec() - start;
+    allocations = alloc_counter_get() - allocations;
+    if(stage->teardown){
+        stage->teardown();
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    dup2(stdout_fd, STDOUT_FILENO);
+    dup2(stderr_fd, STDERR_FILENO);
+    close(stdout_fd);
+    close(stderr_fd);
+    close(null_fd);
+
+    double frames = (double) iterations * stage->input->count;
+    printf("%-32s %12.0f %14.0f %14.3f\n", stage->name, frames, frames / elapsed, allocations / frames);
+}
+
+int main(int argc, char *argv[]){
+    unsigned iterations = 1000;
+    int opt;
+    esp_log_level_set("*", ESP_LOG_NONE);
+    while((opt = getopt(argc, argv, "n:v")) != -1){
+        switch(opt){
+            case 'n':
+                iterations = strtoul(optarg, NULL, 10);
+                break;
+            case 'v':
+                esp_log_level_set("*", ESP_LOG_VERBOSE);
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n iterations] [-v] file.pcap...\n", argv[0]);
+                return 1;
+        }
+    }
+    if(optind >= argc){
+        fprintf(stderr, "Usage: %s [-n iterations] [-v] file.pcap...\n", argv[0]);
+        return 1;
+    }
+
+    unsigned capture_count = argc - optind;
+    pcap_reader_capture_t *captures = calloc(capture_count, sizeof(pcap_reader_capture_t));
+    for(unsigned c = 0; c < capture_count; c++){
+        if(pcap_reader_load(argv[optind + c], &captures[c]) != 0){
+            return 1;
+        }
+        for(unsigned i = 0; i < captures[c].count; i++){
+            pcap_reader_frame_t *frame = &captures[c].frames[i];
+            // Only data frames are passed to frame analyzer by sniffer
+            if((frame->length < sizeof(data_frame_mac_header_t)) || (((data_frame_t *) frame->data)->mac_header.frame_control.type != 2)){
+                continue;
+            }
+            frame_list_add(&data_frames, frame);
+            eapol_key_view_t eapol_key;
+            if(parse_eapol_key_frame((const data_frame_t *) frame->data, frame->length, &eapol_key)){
+                frame_list_add(&eapolkey_frames, frame);
+            }
+        }
+    }
+
+    printf("%u data frames, %u EAPoL-Key frames, %u iterations\n", data_frames.count, eapolkey_frames.count, iterations);
+    printf("%-32s %12s %14s %14s\n", "stage", "frames", "frames/s", "allocs/frame");
+    for(unsigned s = 0; s < sizeof(stages) / sizeof(stages[0]); s++){
+        run_stage(&stages[s], iterations);
+    }
+
+    for(unsigned c = 0; c < capture_count; c++){
+        pcap_reader_free(&captures[c]);
+    }
+    free(captures);
+    free(data_frames.frames);
+    free(eapolkey_frames.frames);
+    return 0;
+}
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+Generates reference captures used by host tests and benchmarks.
+
+wpa2-psk-handshake.pcap contains cryptographically valid WPA2-PSK 4-way handshakes
+(SSID "TestNetwork", passphrase "password123") of two clients, PMKID in M1 of the
+first client and unrelated traffic (other BSSIDs, protected and non-EAPOL data,
+management frames) so filtering paths are exercised as well.
+
+Usage: ./generate_captures.py [output_dir]
+"""
+import hashlib
+import hmac
+import struct
+import sys
+import os
+
+SSID = b"TestNetwork"
+PASSPHRASE = b"password123"
+AP = bytes.fromhex("0211223344aa")
+STA1 = bytes.fromhex("02aabbccdd01")
+STA2 = bytes.fromhex("02aabbccdd02")
+OTHER_AP = bytes.fromhex("02deadbeef00")
+
+LINKTYPE_IEEE802_11 = 105
+
+
+def prf512(key, label, data):
+    out = b""
+    for i in range(4):
+        out += hmac.new(key, label + b"\x00" + data + bytes([i]), hashlib.sha1).digest()
+    return out[:64]
+
+
+def pmk():
+    return hashlib.pbkdf2_hmac("sha1", PASSPHRASE, SSID, 4096, 32)
+
+
+def pmkid(sta):
+    return hmac.new(pmk(), b"PMK Name" + AP + sta, hashlib.sha1).digest()[:16]
+
+
+def kck(sta, anonce, snonce):
+    data = min(AP, sta) + max(AP, sta) + min(anonce, snonce) + max(anonce, snonce)
+    return prf512(pmk(), b"Pairwise key expansion", data)[:16]
+
+
+def eapol_key(key_info, replay, nonce, key_data=b"", mic_key=None):
+    body = struct.pack(">BHH", 2, key_info, 16)
+    body += struct.pack(">Q", replay)
+    body += nonce
+    body += b"\x00" * 16          # key IV
+    body += b"\x00" * 8           # key RSC
+    body += b"\x00" * 8           # reserved
+    mic_offset = len(body) + 4
+    body += b"\x00" * 16          # key MIC
+    body += struct.pack(">H", len(key_data)) + key_data
+    packet = struct.pack(">BBH", 1, 3, len(body)) + body
+    if mic_key is not None:
+        mic = hmac.new(mic_key, packet, hashlib.sha1).digest()[:16]
+        packet = packet[:mic_offset] + mic + packet[mic_offset + 16:]
+    return packet
+
+
+def data_frame(from_ds, addr1, addr2, addr3, payload, qos=False, protected=False, seq=0):
+    fc0 = 0x88 if qos else 0x08
+    fc1 = (0x02 if from_ds else 0x01) | (0x40 if protected else 0x00)
+    header = bytes([fc0, fc1]) + struct.pack("<H", 0x2c) + addr1 + addr2 + addr3 + struct.pack("<H", seq << 4)
+    if qos:
+        header += b"\x07\x00"
+    return header + payload
+
+
+def llc_snap(ethertype):
+    return b"\xaa\xaa\x03\x00\x00\x00" + struct.pack(">H", ethertype)
+
+
+def beacon(bssid, ssid):
+    header = b"\x80\x00\x00\x00" + b"\xff" * 6 + bssid + bssid + b"\x00\x00"
+    body = b"\x00" * 8 + struct.pack("<HH", 100, 0x0411) + bytes([0, len(ssid)]) + ssid
+    return header + body
+
+
+RSN_IE = bytes.fromhex("30140100000fac040100000fac040100000fac020000")
+
+
+def handshake(sta, anonce, snonce, replay, with_pmkid, qos):
+    key = kck(sta, anonce, snonce)
+    m1_data = bytes.fromhex("dd14000fac04") + pmkid(sta) if with_pmkid else b""
+    m1 = eapol_key(0x008a, replay, anonce, m1_data)
+    m2 = eapol_key(0x010a, replay, snonce, RSN_IE, key)
+    m3 = eapol_key(0x13ca, replay + 1, anonce, bytes(range(56)), key)
+    m4 = eapol_key(0x030a, replay + 1, b"\x00" * 32, b"", key)
+    eapol = llc_snap(0x888e)
+    return [
+        data_frame(True, sta, AP, AP, eapol + m1, qos),
+        data_frame(False, AP, sta, AP, eapol + m2, qos),
+        data_frame(True, sta, AP, AP, eapol + m3, qos),
+        data_frame(False, AP, sta, AP, eapol + m4, qos),
+    ]
+
+
+def noise():
+    frames = [beacon(AP, SSID), beacon(OTHER_AP, b"Other")]
+    frames.append(data_frame(True, STA1, OTHER_AP, OTHER_AP, llc_snap(0x0800) + bytes(40)))
+    frames.append(data_frame(True, STA1, AP, AP, bytes(64), protected=True))
+    frames.append(data_frame(False, AP, STA1, AP, llc_snap(0x0800) + bytes(60), qos=True))
+    frames.append(data_frame(True, STA2, OTHER_AP, OTHER_AP, llc_snap(0x888e) + eapol_key(0x008a, 1, bytes(32))))
+    return frames
+
+
+def write_pcap(path, frames):
+    with open(path, "wb") as f:
+        f.write(struct.pack("<IHHiIII", 0xa1b2c3d4, 2, 4, 0, 0, 65535, LINKTYPE_IEEE802_11))
+        for i, frame in enumerate(frames):
+            ts = 1000000 + i * 1500
+            f.write(struct.pack("<IIII", ts // 1000000, ts % 1000000, len(frame), len(frame)))
+            f.write(frame)
+
+
+def main():
+    out_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    anonce1 = hashlib.sha256(b"anonce1").digest()
+    snonce1 = hashlib.sha256(b"snonce1").digest()
+    anonce2 = hashlib.sha256(b"anonce2").digest()
+    snonce2 = hashlib.sha256(b"snonce2").digest()
+
+    n = noise()
+    h1 = handshake(STA1, anonce1, snonce1, 1, True, False)
+    h2 = handshake(STA2, anonce2, snonce2, 7, False, True)
+    frames = n[:3] + h1[:2] + n[3:] + h2[:2] + h1[2:] + h2[2:]
+    write_pcap(os.path.join(out_dir, "wpa2-psk-handshake.pcap"), frames)
+    print("PMKID STA1: " + pmkid(STA1).hex())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,155 @@
+/**
+ * @file fuzz_driver.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Standalone driver of fuzz targets for builds without libFuzzer.
+ *
+ * Usage: fuzz_<target> [-n iterations] [-v] file_or_directory...
+ *
+ * Every input file (directories are read one level deep) is passed to LLVMFuzzerTestOneInput()
+ * in its own exactly sized heap buffer, so sanitizers catch reads past the input.
+ * It is used to replay seed and regression corpus in ctest and with AFL (afl-fuzz ... -- fuzz_<target> @@).
+ * Reported executions per second serve as parser throughput regression signal.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "esp_log.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/**
+ * @brief Input loaded from corpus file
+ */
+typedef struct {
+    uint8_t *data;
+    size_t size;
+} fuzz_input_t;
+
+static fuzz_input_t *inputs = NULL;
+static unsigned input_count = 0;
+
+static int load_file(const char *path){
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        perror(path);
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    // at least one byte, so malloc(0) doesn't return NULL for empty input
+    uint8_t *data = malloc(size > 0 ? size : 1);
+    if(fread(data, 1, size, file) != (size_t) size){
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(file);
+        free(data);
+        return -1;
+    }
+    fclose(file);
+    inputs = realloc(inputs, (input_count + 1) * sizeof(fuzz_input_t));
+    inputs[input_count].data = data;
+    inputs[input_count].size = size;
+    input_count++;
+    return 0;
+}
+
+static int load_path(const char *path){
+    struct stat path_stat;
+    if(stat(path, &path_stat) != 0){
+        perror(path);
+        return -1;
+    }
+    if(!S_ISDIR(path_stat.st_mode)){
+        return load_file(path);
+    }
+    DIR *dir = opendir(path);
+    if(dir == NULL){
+        perror(path);
+        return -1;
+    }
+    struct dirent *entry;
+    while((entry = readdir(dir)) != NULL){
+        if(entry->d_name[0] == '.'){
+            continue;
+        }
+        char file_path[4096];
+        snprintf(file_path, sizeof(file_path), "%s/%s", path, entry->d_name);
+        if(load_file(file_path) != 0){
+            closedir(dir);
+            return -1;
+        }
+    }
+    closedir(dir);
+    return 0;
+}
+
+static double now_sec(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[]){
+    unsigned iterations = 1;
+    int opt;
+    esp_log_level_set("*", ESP_LOG_NONE);
+    while((opt = getopt(argc, argv, "n:v")) != -1){
+        switch(opt){
+            case 'n':
+                iterations = strtoul(optarg, NULL, 10);
+                break;
+            case 'v':
+                esp_log_level_set("*", ESP_LOG_VERBOSE);
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n iterations] [-v] file_or_directory...\n", argv[0]);
+                return 1;
+        }
+    }
+    if(optind >= argc){
+        fprintf(stderr, "Usage: %s [-n iterations] [-v] file_or_directory...\n", argv[0]);
+        return 1;
+    }
+    for(int i = optind; i < argc; i++){
+        if(load_path(argv[i]) != 0){
+            return 1;
+        }
+    }
+
+    // debug printf of targets would dominate measured time
+    fflush(stdout);
+    int stdout_fd = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+
+    double start = now_sec();
+    for(unsigned i = 0; i < iterations; i++){
+        for(unsigned f = 0; f < input_count; f++){
+            LLVMFuzzerTestOneInput(inputs[f].data, inputs[f].size);
+        }
+    }
+    double elapsed = now_sec() - start;
+
+    fflush(stdout);
+    dup2(stdout_fd, STDOUT_FILENO);
+    close(stdout_fd);
+    close(null_fd);
+
+    double executions = (double) iterations * input_count;
+    printf("%u inputs, %.0f executions, %.0f exec/s\n", input_count, executions, elapsed > 0 ? executions / elapsed : 0);
+
+    for(unsigned f = 0; f < input_count; f++){
+        free(inputs[f].data);
+    }
+    free(inputs);
+    return 0;
+}
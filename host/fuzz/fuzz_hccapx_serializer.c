@@ -0,0 +1,47 @@
+/**
+ * @file fuzz_hccapx_serializer.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Fuzz target of handshake state machine in HCCAPX serializer and hc22000 output built on top of it.
+ *
+ * Input is sequence of IEEE 802.11 frames, each prefixed by its length (16 bit, little endian).
+ * Truncated last frame is passed as is.
+ * Every frame is copied to its own exactly sized heap buffer, so it's aligned as frames in sniffer ring slots
+ * and sanitizers catch reads past the frame.
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "frame_analyzer_types.h"
+#include "hccapx_serializer.h"
+#include "hc22000_serializer.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+    static const char ssid[] = "TestNetwork";
+    static char line[HC22000_SERIALIZER_MAX_LINE_SIZE];
+    hccapx_serializer_init((const uint8_t *) ssid, sizeof(ssid) - 1);
+    hc22000_serializer_init((const uint8_t *) ssid, sizeof(ssid) - 1);
+
+    size_t offset = 0;
+    while(size - offset >= 2){
+        size_t length = data[offset] | (data[offset + 1] << 8);
+        offset += 2;
+        if(length > size - offset){
+            length = size - offset;
+        }
+        uint8_t *frame = malloc(length > 0 ? length : 1);
+        memcpy(frame, &data[offset], length);
+        hccapx_serializer_add_frame((const data_frame_t *) frame, length);
+        hc22000_serializer_add_frame((const data_frame_t *) frame, length);
+        free(frame);
+        offset += length;
+    }
+
+    for(unsigned i = 0; i < hc22000_serializer_get_count(); i++){
+        hc22000_serializer_get_line(i, line, sizeof(line));
+    }
+    return 0;
+}
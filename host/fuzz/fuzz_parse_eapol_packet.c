@@ -0,0 +1,30 @@
+/**
+ * @file fuzz_parse_eapol_packet.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Fuzz target of EAPoL-Key frame parsing.
+ *
+ * Input is single IEEE 802.11 frame as received by sniffer, without radio metadata.
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "frame_analyzer_parser.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+    eapol_key_view_t eapol_key;
+    if(!parse_eapol_key_frame((const data_frame_t *) data, size, &eapol_key)){
+        return 0;
+    }
+    // touch whole view, so sanitizers catch view pointing outside of input
+    volatile uint8_t sum = 0;
+    for(unsigned i = 0; i < eapol_key.eapol_length; i++){
+        sum += ((const uint8_t *) eapol_key.eapol_packet)[i];
+    }
+    for(unsigned i = 0; i < eapol_key.key_data_length; i++){
+        sum += eapol_key.key_data[i];
+    }
+    (void) sum;
+    return 0;
+}
@@ -0,0 +1,25 @@
+/**
+ * @file fuzz_parse_pmkid.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Fuzz target of PMKID parsing from Key Data of EAPoL-Key frame.
+ *
+ * Input is single IEEE 802.11 frame as received by sniffer, without radio metadata.
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "frame_analyzer_parser.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+    eapol_key_view_t eapol_key;
+    if(!parse_eapol_key_frame((const data_frame_t *) data, size, &eapol_key)){
+        return 0;
+    }
+    pmkid_result_t pmkid_result;
+    if(parse_pmkid(&eapol_key, &pmkid_result) && (pmkid_result.count > PMKID_RESULT_MAX_COUNT)){
+        __builtin_trap();
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Generates seed and regression corpus of fuzz targets.
+
+corpus/frame and corpus/sequence are seeds built from the same frames as the reference
+capture (data/generate_captures.py). regression/ contains hand crafted malformed inputs
+that hit parser edge cases (truncation, length fields overflowing the frame, zero length
+Key Data elements, session table exhaustion). Both are replayed by ctest.
+
+Frame targets take single IEEE 802.11 frame. Sequence target takes frames prefixed
+by their length (16 bit, little endian).
+
+Usage: ./generate_corpus.py [output_dir]
+"""
+import hashlib
+import os
+import struct
+import sys
+
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "data"))
+from generate_captures import (AP, STA1, STA2, RSN_IE, eapol_key, data_frame, handshake,  # noqa: E402
+                               llc_snap, noise, pmkid)
+
+
+def sequence(frames):
+    return b"".join(struct.pack("<H", len(frame)) + frame for frame in frames)
+
+
+def m1(payload_key_data, sta=STA1):
+    return data_frame(True, sta, AP, AP, llc_snap(0x888e) + eapol_key(0x008a, 1, bytes(32), payload_key_data))
+
+
+def patch(frame, offset, data):
+    return frame[:offset] + data + frame[offset + len(data):]
+
+
+# offset of EAPoL packet in non-QoS 3-address data frame
+EAPOL_OFFSET = 24 + 8
+
+
+def regression_frames():
+    kde = bytes.fromhex("dd14000fac04") + pmkid(STA1)
+    frames = {}
+    # zero length elements used to stall Key Data walk, PMKID KDE is cut in the middle
+    frames["keydata-zero-length-element"] = m1(bytes.fromhex("3000dd00") + kde[:10])
+    frames["keydata-pmkid-after-other-elements"] = m1(bytes.fromhex("3000dd00") + RSN_IE + kde)
+    frames["keydata-pmkid-kde-short"] = m1(bytes.fromhex("dd04000fac04"))
+    frames["keydata-pmkid-wrong-oui"] = m1(bytes.fromhex("dd14506f9a04") + pmkid(STA1))
+    # Key Data length field claims more than EAPoL packet carries
+    frame = m1(kde)
+    frames["keydata-length-overflow"] = patch(frame, EAPOL_OFFSET + 4 + 93, struct.pack(">H", 0xffff))
+    # EAPoL body length claims more than frame carries
+    frames["eapol-body-length-overflow"] = patch(frame, EAPOL_OFFSET + 2, struct.pack(">H", 0xfff0))
+    frames["eapol-body-length-zero"] = patch(frame, EAPOL_OFFSET + 2, struct.pack(">H", 0))
+    frames["eapol-truncated"] = frame[:EAPOL_OFFSET + 40]
+    frames["eapol-not-key"] = patch(frame, EAPOL_OFFSET + 1, b"\x00")
+    # QoS data frame with HT Control field cut right after MAC header
+    qos = data_frame(True, STA1, AP, AP, llc_snap(0x888e) + eapol_key(0x008a, 1, bytes(32), kde), qos=True)
+    frames["qos-htc-truncated"] = patch(qos, 1, bytes([qos[1] | 0x80]))[:26]
+    frames["qos-htc-eapol"] = patch(qos[:26] + bytes(4) + qos[26:], 1, bytes([qos[1] | 0x80]))
+    # 4-address frame carries addr4 in front of LLC SNAP
+    wds = data_frame(True, STA1, AP, AP, llc_snap(0x888e) + eapol_key(0x008a, 1, bytes(32), kde))
+    frames["four-address-eapol"] = patch(wds[:24] + AP + wds[24:], 1, b"\x03")
+    frames["header-only"] = frame[:24]
+    frames["empty"] = b""
+    return frames
+
+
+def regression_sequences():
+    anonce = hashlib.sha256(b"anonce1").digest()
+    snonce = hashlib.sha256(b"snonce1").digest()
+    h = handshake(STA1, anonce, snonce, 1, True, False)
+    sequences = {}
+    sequences["reversed-handshake"] = sequence(list(reversed(h)))
+    sequences["replay-counter-mismatch"] = sequence([h[0], patch(h[1], EAPOL_OFFSET + 9, struct.pack(">Q", 5))])
+    sequences["truncated-tail"] = sequence(h)[:-20]
+    # more clients than session table can hold
+    clients = []
+    for i in range(20):
+        sta = bytes.fromhex("02aabbccdd") + bytes([0x10 + i])
+        clients += handshake(sta, anonce, snonce, 1, False, False)[:2]
+    sequences["session-table-overflow"] = sequence(clients)
+    return sequences
+
+
+def write_dir(path, files):
+    os.makedirs(path, exist_ok=True)
+    for name, data in files.items():
+        with open(os.path.join(path, name), "wb") as f:
+            f.write(data)
+
+
+def main():
+    out_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    anonce1 = hashlib.sha256(b"anonce1").digest()
+    snonce1 = hashlib.sha256(b"snonce1").digest()
+    anonce2 = hashlib.sha256(b"anonce2").digest()
+    snonce2 = hashlib.sha256(b"snonce2").digest()
+    h1 = handshake(STA1, anonce1, snonce1, 1, True, False)
+    h2 = handshake(STA2, anonce2, snonce2, 7, False, True)
+
+    frames = {}
+    for name, handshake_frames in (("sta1", h1), ("sta2", h2)):
+        for i, frame in enumerate(handshake_frames):
+            frames["{}-m{}".format(name, i + 1)] = frame
+    for i, frame in enumerate(noise()):
+        frames["noise-{}".format(i)] = frame
+    write_dir(os.path.join(out_dir, "corpus", "frame"), frames)
+    write_dir(os.path.join(out_dir, "corpus", "sequence"), {
+        "sta1-handshake": sequence(h1),
+        "sta2-handshake": sequence(h2),
+        "interleaved-handshakes": sequence(noise()[:3] + h1[:2] + h2[:2] + h1[2:] + h2[2:]),
+    })
+    write_dir(os.path.join(out_dir, "regression", "frame"), regression_frames())
+    write_dir(os.path.join(out_dir, "regression", "sequence"), regression_sequences())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,48 @@
+/**
+ * @file host_sniffer.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements sniffer entry points on host on top of sniffer pipeline.
+ */
+#include "host_sniffer.h"
+
+#include "esp_err.h"
+#include "wifi_controller.h"
+#include "sniffer_pipeline.h"
+
+esp_err_t wifictl_sniffer_subscribe(const sniffer_match_t *match, sniffer_frame_cb_t callback, sniffer_batch_end_cb_t batch_end, void *args, sniffer_subscription_t *subscription){
+    esp_err_t err = sniffer_pipeline_init();
+    if(err != ESP_OK){
+        return err;
+    }
+    return sniffer_pipeline_subscribe(match, callback, batch_end, args, subscription);
+}
+
+void wifictl_sniffer_unsubscribe(sniffer_subscription_t subscription){
+    sniffer_pipeline_unsubscribe(subscription);
+}
+
+esp_err_t wifictl_sniffer_get_filter_stats(sniffer_subscription_t subscription, sniffer_filter_stats_t *stats){
+    return sniffer_pipeline_get_filter_stats(subscription, stats);
+}
+
+void wifictl_sniffer_inject(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type){
+    ESP_ERROR_CHECK(sniffer_pipeline_init());
+    sniffer_pipeline_ingest(frame, type);
+    // batches are dispatched in the same sizes as sniffer task dispatches them when it keeps up
+    if(sniffer_pipeline_pending() >= CONFIG_SNIFFER_BATCH_SIZE){
+        sniffer_pipeline_dispatch_batch();
+    }
+}
+
+unsigned wifictl_sniffer_get_dropped_count(){
+    unsigned dropped, oversized;
+    sniffer_pipeline_get_dropped(&dropped, &oversized);
+    return dropped + oversized;
+}
+
+void host_sniffer_flush(){
+    while(sniffer_pipeline_dispatch_batch() > 0){
+    }
+}
@@ -0,0 +1,19 @@
+/**
+ * @file host_sniffer.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides host implementation of sniffer entry points of wifi_controller.
+ *
+ * Subscriptions and injected frames go through the same sniffer pipeline as on device.
+ * There is no sniffer task, injecting thread dispatches every full batch itself.
+ */
+#ifndef HOST_SNIFFER_H
+#define HOST_SNIFFER_H
+
+/**
+ * @brief Dispatches frames left in frame ring after last injected frame.
+ */
+void host_sniffer_flush();
+
+#endif
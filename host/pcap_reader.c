@@ -0,0 +1,63 @@
+/**
+ * @file pcap_reader.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Implements minimal PCAP file reader for host tests and benchmarks.
+ */
+#include "pcap_reader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pcap_serializer.h"
+
+#define PCAP_MAGIC_NUMBER 0xa1b2c3d4
+#define LINKTYPE_IEEE802_11 105
+
+int pcap_reader_load(const char *path, pcap_reader_capture_t *capture){
+    memset(capture, 0, sizeof(pcap_reader_capture_t));
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+    pcap_global_header_t global_header;
+    if((fread(&global_header, sizeof(global_header), 1, file) != 1)
+        || (global_header.magic_number != PCAP_MAGIC_NUMBER)
+        || (global_header.network != LINKTYPE_IEEE802_11)){
+        fprintf(stderr, "%s: unsupported PCAP format\n", path);
+        fclose(file);
+        return -1;
+    }
+
+    unsigned capacity = 0;
+    pcap_record_header_t record_header;
+    while(fread(&record_header, sizeof(record_header), 1, file) == 1){
+        if(capture->count == capacity){
+            capacity = capacity ? capacity * 2 : 64;
+            capture->frames = realloc(capture->frames, capacity * sizeof(pcap_reader_frame_t));
+        }
+        pcap_reader_frame_t *frame = &capture->frames[capture->count];
+        frame->ts_usec = (uint64_t) record_header.ts_sec * 1000000 + record_header.ts_usec;
+        frame->length = record_header.incl_len;
+        frame->data = malloc(frame->length);
+        if(fread(frame->data, 1, frame->length, file) != frame->length){
+            fprintf(stderr, "%s: truncated record %u\n", path, capture->count);
+            free(frame->data);
+            break;
+        }
+        capture->count++;
+    }
+    fclose(file);
+    return 0;
+}
+
+void pcap_reader_free(pcap_reader_capture_t *capture){
+    for(unsigned i = 0; i < capture->count; i++){
+        free(capture->frames[i].data);
+    }
+    free(capture->frames);
+    memset(capture, 0, sizeof(pcap_reader_capture_t));
+}
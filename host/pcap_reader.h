@@ -0,0 +1,49 @@
+/**
+ * @file pcap_reader.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Provides minimal PCAP file reader for host tests and benchmarks.
+ */
+#ifndef PCAP_READER_H
+#define PCAP_READER_H
+
+#include <stdint.h>
+
+/**
+ * @brief Single frame loaded from PCAP file.
+ */
+typedef struct {
+    uint64_t ts_usec;   ///< timestamp of the frame in microseconds
+    unsigned length;
+    uint8_t *data;      ///< raw 802.11 frame
+} pcap_reader_frame_t;
+
+/**
+ * @brief All frames loaded from PCAP file.
+ */
+typedef struct {
+    unsigned count;
+    pcap_reader_frame_t *frames;
+} pcap_reader_capture_t;
+
+/**
+ * @brief Loads all frames from PCAP file into memory.
+ *
+ * Only LINKTYPE_IEEE802_11 captures are supported.
+ *
+ * @param path path to PCAP file
+ * @param capture loaded capture
+ * @return 0 on success
+ * @return -1 if file cannot be read or has unsupported format
+ */
+int pcap_reader_load(const char *path, pcap_reader_capture_t *capture);
+
+/**
+ * @brief Frees all frames of capture.
+ *
+ * @param capture
+ */
+void pcap_reader_free(pcap_reader_capture_t *capture);
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file replay_main.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Replays recorded PCAP file through the whole capture pipeline of handshake attack.
+ *
+ * Usage: host_replay [-n iterations] [-r] [-v] [-o prefix] -b bssid -s ssid file.pcap
+ *
+ * Frames go through sniffer subscription filters, frame ring, frame analyzer and PCAP, HCCAPX and HC22000
+ * serializers in the same way as frames captured on device. It reports end-to-end throughput
+ * and handshakes reconstructed by the last iteration. Option -r keeps recorded gaps between frames,
+ * -o writes results of the last iteration into <prefix>.pcap, <prefix>.hccapx and <prefix>.hc22000.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+#include "frame_analyzer.h"
+#include "pcap_serializer.h"
+#include "hccapx_serializer.h"
+#include "hc22000_serializer.h"
+#include "capture_clock.h"
+#include "capture_replay.h"
+#include "wifi_controller.h"
+
+#include "host_sniffer.h"
+
+#define USAGE "Usage: %s [-n iterations] [-r] [-v] [-o prefix] -b bssid -s ssid file.pcap\n"
+
+/**
+ * @brief Capture loaded into memory, so file reads aren't measured
+ */
+typedef struct {
+    uint8_t *data;
+    size_t size;
+} memory_capture_t;
+
+static esp_err_t memory_read(void *ctx, size_t offset, void *data, size_t length){
+    const memory_capture_t *capture = ctx;
+    if(offset + length > capture->size){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(data, &capture->data[offset], length);
+    return ESP_OK;
+}
+
+static int load_file(const char *path, memory_capture_t *capture){
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        perror(path);
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    capture->size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    capture->data = malloc(capture->size);
+    int result = (fread(capture->data, 1, capture->size, file) == capture->size) ? 0 : -1;
+    fclose(file);
+    return result;
+}
+
+static bool parse_mac(const char *text, uint8_t *mac){
+    unsigned bytes[6];
+    if(sscanf(text, "%x:%x:%x:%x:%x:%x", &bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4], &bytes[5]) != 6){
+        return false;
+    }
+    for(unsigned i = 0; i < 6; i++){
+        mac[i] = bytes[i];
+    }
+    return true;
+}
+
+static unsigned eapolkey_frame_count;
+
+/**
+ * @brief Serializes EAPOL-Key frames of sniffer batch as handshake attack does.
+ */
+static void eapolkey_frame_handler(const wifi_promiscuous_pkt_t *const *frames, unsigned count){
+    pcap_serializer_frame_t pcap_frames[CONFIG_SNIFFER_BATCH_SIZE];
+    for(unsigned i = 0; i < count; i++){
+        const wifi_promiscuous_pkt_t *frame = frames[i];
+        pcap_frames[i] = (pcap_serializer_frame_t) {
+            .buffer = frame->payload,
+            .size = frame->rx_ctrl.sig_len,
+            .ts_usec = capture_clock_get_timestamp(frame->rx_ctrl.timestamp),
+            .rx_ctrl = &frame->rx_ctrl
+        };
+        hccapx_serializer_add_frame((const data_frame_t *) frame->payload, frame->rx_ctrl.sig_len);
+        hc22000_serializer_add_frame((const data_frame_t *) frame->payload, frame->rx_ctrl.sig_len);
+    }
+    pcap_serializer_append_frames(pcap_frames, count);
+    eapolkey_frame_count += count;
+}
+
+static int write_results(const char *prefix){
+    char path[256];
+    FILE *file;
+
+    snprintf(path, sizeof(path), "%s.pcap", prefix);
+    if((file = fopen(path, "wb")) == NULL){
+        perror(path);
+        return -1;
+    }
+    uint8_t buffer[4096];
+    unsigned offset = 0;
+    unsigned length;
+    while((length = pcap_serializer_read(offset, buffer, sizeof(buffer))) > 0){
+        fwrite(buffer, 1, length, file);
+        offset += length;
+    }
+    fclose(file);
+
+    snprintf(path, sizeof(path), "%s.hccapx", prefix);
+    if((file = fopen(path, "wb")) == NULL){
+        perror(path);
+        return -1;
+    }
+    hccapx_t hccapx;
+    for(unsigned i = 0; hccapx_serializer_get(i, &hccapx); i++){
+        fwrite(&hccapx, sizeof(hccapx_t), 1, file);
+    }
+    fclose(file);
+
+    snprintf(path, sizeof(path), "%s.hc22000", prefix);
+    if((file = fopen(path, "w")) == NULL){
+        perror(path);
+        return -1;
+    }
+    char line[HC22000_SERIALIZER_MAX_LINE_SIZE];
+    for(unsigned i = 0; i < hc22000_serializer_get_count(); i++){
+        if(hc22000_serializer_get_line(i, line, sizeof(line)) > 0){
+            fputs(line, file);
+        }
+    }
+    fclose(file);
+    return 0;
+}
+
+int main(int argc, char *argv[]){
+    unsigned iterations = 1;
+    capture_replay_config_t config = { .realtime = false, .channel = 1 };
+    const char *ssid = NULL;
+    const char *prefix = NULL;
+    uint8_t bssid[6];
+    bool bssid_set = false;
+    int opt;
+    esp_log_level_set("*", ESP_LOG_WARN);
+    while((opt = getopt(argc, argv, "n:rvo:b:s:")) != -1){
+        switch(opt){
+            case 'n':
+                iterations = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                config.realtime = true;
+                break;
+            case 'v':
+                esp_log_level_set("*", ESP_LOG_VERBOSE);
+                break;
+            case 'o':
+                prefix = optarg;
+                break;
+            case 'b':
+                bssid_set = parse_mac(optarg, bssid);
+                break;
+            case 's':
+                ssid = optarg;
+                break;
+            default:
+                fprintf(stderr, USAGE, argv[0]);
+                return 1;
+        }
+    }
+    if((optind >= argc) || !bssid_set || (ssid == NULL) || (iterations == 0)){
+        fprintf(stderr, USAGE, argv[0]);
+        return 1;
+    }
+    memory_capture_t capture;
+    if(load_file(argv[optind], &capture) != 0){
+        return 1;
+    }
+
+    capture_replay_stats_t stats;
+    unsigned frames = 0;
+    uint64_t elapsed_usec = 0;
+    for(unsigned n = 0; n < iterations; n++){
+        ESP_ERROR_CHECK(pcap_serializer_init("host replay"));
+        hccapx_serializer_init((const uint8_t *) ssid, strlen(ssid));
+        hc22000_serializer_init((const uint8_t *) ssid, strlen(ssid));
+        capture_clock_reset();
+        eapolkey_frame_count = 0;
+        frame_analyzer_capture_start(SEARCH_HANDSHAKE, bssid, &eapolkey_frame_handler);
+        esp_err_t err = capture_replay_run(&memory_read, &capture, capture.size, &config, &stats);
+        host_sniffer_flush();
+        frame_analyzer_capture_stop();
+        if(err != ESP_OK){
+            fprintf(stderr, "Replay failed: 0x%x\n", err);
+            return 1;
+        }
+        frames += stats.frames;
+        elapsed_usec += stats.elapsed_usec;
+        if(n + 1 < iterations){
+            pcap_serializer_deinit();
+        }
+    }
+
+    printf("%u frames (%u skipped) per iteration, %u iterations\n", stats.frames, stats.skipped, iterations);
+    printf("%.0f frames/s end-to-end, %u dropped by sniffer\n", frames / (elapsed_usec / 1e6), wifictl_sniffer_get_dropped_count());
+    printf("%u EAPoL-Key frames, %u HCCAPX records, %u HC22000 lines\n",
+        eapolkey_frame_count, hccapx_serializer_get_count(), hc22000_serializer_get_count());
+    int result = 0;
+    if(prefix != NULL){
+        result = write_results(prefix);
+    }
+    pcap_serializer_deinit();
+    free(capture.data);
+    return result ? 1 : 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file esp_event.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF default event loop with synchronous dispatch.
+ */
+#include "esp_event.h"
+
+#include <stdbool.h>
+
+#define MAX_HANDLERS 16
+
+typedef struct {
+    bool used;
+    esp_event_base_t event_base;
+    int32_t event_id;
+    esp_event_handler_t handler;
+    void *arg;
+} handler_entry_t;
+
+static handler_entry_t handlers[MAX_HANDLERS];
+
+esp_err_t esp_event_handler_register(esp_event_base_t event_base, int32_t event_id, esp_event_handler_t event_handler, void *event_handler_arg){
+    for(unsigned i = 0; i < MAX_HANDLERS; i++){
+        if(!handlers[i].used){
+            handlers[i] = (handler_entry_t) { true, event_base, event_id, event_handler, event_handler_arg };
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t esp_event_handler_unregister(esp_event_base_t event_base, int32_t event_id, esp_event_handler_t event_handler){
+    for(unsigned i = 0; i < MAX_HANDLERS; i++){
+        if(handlers[i].used && (handlers[i].event_base == event_base) && (handlers[i].event_id == event_id)
+            && (handlers[i].handler == event_handler)){
+            handlers[i].used = false;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id, const void *event_data, size_t event_data_size, TickType_t ticks_to_wait){
+    for(unsigned i = 0; i < MAX_HANDLERS; i++){
+        if(handlers[i].used && (handlers[i].event_base == event_base)
+            && ((handlers[i].event_id == ESP_EVENT_ANY_ID) || (handlers[i].event_id == event_id))){
+            // handler gets posted data directly, on device it gets copy from event queue
+            handlers[i].handler(handlers[i].arg, event_base, event_id, (void *) event_data);
+        }
+    }
+    return ESP_OK;
+}
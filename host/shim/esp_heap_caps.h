@@ -0,0 +1,39 @@
+/**
+ * @file esp_heap_caps.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF capability based heap. Host has single pool, so capabilities are ignored.
+ */
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps){
+    (void) caps;
+    return malloc(size);
+}
+
+static inline void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps){
+    (void) caps;
+    return realloc(ptr, size);
+}
+
+static inline size_t heap_caps_get_free_size(uint32_t caps){
+    (void) caps;
+    return 0;
+}
+
+static inline size_t heap_caps_get_minimum_free_size(uint32_t caps){
+    (void) caps;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,37 @@
+/**
+ * @file esp_log.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF logging library. Writes log lines to stderr.
+ */
+#include "esp_log.h"
+
+#include <stdarg.h>
+#include <time.h>
+
+static esp_log_level_t runtime_level = ESP_LOG_INFO;
+static const char level_letters[] = "NEWIDV";
+
+void esp_log_level_set(const char *tag, esp_log_level_t level){
+    (void) tag;
+    runtime_level = level;
+}
+
+uint32_t esp_log_timestamp(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) (now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...){
+    if(level > runtime_level){
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    fprintf(stderr, "%c (%u) %s: ", level_letters[level], esp_log_timestamp(), tag);
+    vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
@@ -0,0 +1,53 @@
+/**
+ * @file esp_log.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF logging library.
+ *
+ * Same as in ESP-IDF, messages above LOG_LOCAL_LEVEL are removed at compile time
+ * and the rest is filtered by runtime level set by esp_log_level_set().
+ */
+#ifndef HOST_SHIM_ESP_LOG_H
+#define HOST_SHIM_ESP_LOG_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "sdkconfig.h"
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+#ifndef LOG_LOCAL_LEVEL
+#define LOG_LOCAL_LEVEL ESP_LOG_INFO
+#endif
+
+/**
+ * @brief Sets runtime log level. Tag is ignored, level applies to all tags.
+ */
+void esp_log_level_set(const char *tag, esp_log_level_t level);
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...) __attribute__((format(printf, 3, 4)));
+
+uint32_t esp_log_timestamp(void);
+
+#define ESP_LOG_LEVEL_LOCAL(level, tag, format, ...) do {                               \
+        if(LOG_LOCAL_LEVEL >= (level)){                                                 \
+            esp_log_write((level), (tag), format, ##__VA_ARGS__);                       \
+        }                                                                               \
+    } while(0)
+
+#define ESP_LOGE(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+
+#endif
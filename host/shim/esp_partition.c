@@ -0,0 +1,68 @@
+/**
+ * @file esp_partition.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF partition API with RAM backed NOR flash emulation.
+ */
+#include "esp_partition.h"
+
+#include <string.h>
+
+static const esp_partition_t capture_partition = {
+    .type = ESP_PARTITION_TYPE_DATA,
+    .subtype = 0x40,
+    .address = 0x110000,
+    .size = HOST_PARTITION_SIZE,
+    .label = "capture"
+};
+
+static uint8_t flash[HOST_PARTITION_SIZE];
+/**
+ * @brief Writes left until injected failure, negative if no failure is injected
+ */
+static int writes_until_failure = -1;
+
+void host_partition_fail_write(unsigned successful_writes){
+    writes_until_failure = successful_writes;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label){
+    if((type != capture_partition.type) || ((label != NULL) && (strcmp(label, capture_partition.label) != 0))){
+        return NULL;
+    }
+    return &capture_partition;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size){
+    if(src_offset + size > partition->size){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(dst, &flash[src_offset], size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size){
+    if(dst_offset + size > partition->size){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if((writes_until_failure >= 0) && (writes_until_failure-- == 0)){
+        return ESP_FAIL;
+    }
+    const uint8_t *source = (const uint8_t *) src;
+    for(size_t i = 0; i < size; i++){
+        flash[dst_offset + i] &= source[i];
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size){
+    if((offset % HOST_PARTITION_SECTOR_SIZE) || (size % HOST_PARTITION_SECTOR_SIZE)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(offset + size > partition->size){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memset(&flash[offset], 0xff, size);
+    return ESP_OK;
+}
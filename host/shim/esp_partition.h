@@ -0,0 +1,52 @@
+/**
+ * @file esp_partition.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF partition API.
+ *
+ * Provides single RAM backed data partition labeled "capture" that behaves like NOR flash:
+ * erase sets bytes to 0xff and write can only clear bits.
+ * Write failure can be injected by host_partition_fail_write().
+ */
+#ifndef HOST_SHIM_ESP_PARTITION_H
+#define HOST_SHIM_ESP_PARTITION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#define HOST_PARTITION_SIZE (1024 * 1024)
+#define HOST_PARTITION_SECTOR_SIZE 4096
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label);
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size);
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size);
+
+/**
+ * @brief Makes one of following writes fail with ESP_FAIL.
+ *
+ * @param successful_writes number of writes that succeed before the failing one
+ */
+void host_partition_fail_write(unsigned successful_writes);
+
+#endif
@@ -0,0 +1,23 @@
+/**
+ * @file esp_timer.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF high resolution timer. Only current time is supported.
+ */
+#ifndef HOST_SHIM_ESP_TIMER_H
+#define HOST_SHIM_ESP_TIMER_H
+
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief Returns time since start in microseconds
+ */
+static inline int64_t esp_timer_get_time(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+#endif
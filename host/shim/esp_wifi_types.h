@@ -0,0 +1,78 @@
+/**
+ * @file esp_wifi_types.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of ESP-IDF Wi-Fi types used by capture components and wifi_controller headers.
+ *
+ * Layout of wifi_pkt_rx_ctrl_t follows ESP32 ESP-IDF definition, so payload stays word aligned.
+ */
+#ifndef HOST_SHIM_ESP_WIFI_TYPES_H
+#define HOST_SHIM_ESP_WIFI_TYPES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// pulled in by ESP-IDF Wi-Fi headers as well, wifi_controller headers rely on it
+#include "sdkconfig.h"
+
+typedef struct {
+    signed rssi:8;
+    unsigned rate:5;
+    unsigned :1;
+    unsigned sig_mode:2;
+    unsigned :16;
+    unsigned mcs:7;
+    unsigned cwb:1;
+    unsigned :16;
+    unsigned smoothing:1;
+    unsigned not_sounding:1;
+    unsigned :1;
+    unsigned aggregation:1;
+    unsigned stbc:2;
+    unsigned fec_coding:1;
+    unsigned sgi:1;
+    signed noise_floor:8;
+    unsigned ampdu_cnt:8;
+    unsigned channel:4;
+    unsigned secondary_channel:4;
+    unsigned :8;
+    unsigned timestamp:32;
+    unsigned :32;
+    unsigned :31;
+    unsigned ant:1;
+    unsigned sig_len:12;
+    unsigned :12;
+    unsigned rx_state:8;
+} wifi_pkt_rx_ctrl_t;
+
+typedef struct {
+    wifi_pkt_rx_ctrl_t rx_ctrl;
+    uint8_t payload[0];
+} wifi_promiscuous_pkt_t;
+
+/**
+ * @brief Scan result. Only fields read by host built code are provided.
+ */
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    int8_t rssi;
+} wifi_ap_record_t;
+
+/**
+ * @brief AP/STA configuration. Only passed by pointer in declarations, host built code doesn't use it.
+ */
+typedef union {
+    uint8_t unused;
+} wifi_config_t;
+
+typedef enum {
+    WIFI_PKT_MGMT,
+    WIFI_PKT_CTRL,
+    WIFI_PKT_DATA,
+    WIFI_PKT_MISC,
+} wifi_promiscuous_pkt_type_t;
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * @file freertos.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host shim of FreeRTOS primitives backed by pthreads.
+ */
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+struct host_semaphore {
+    pthread_mutex_t mutex;
+};
+
+static SemaphoreHandle_t create_mutex(int type){
+    SemaphoreHandle_t semaphore = malloc(sizeof(struct host_semaphore));
+    if(semaphore != NULL){
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr, type);
+        pthread_mutex_init(&semaphore->mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+    }
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void){
+    return create_mutex(PTHREAD_MUTEX_NORMAL);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait){
+    (void) ticks_to_wait;
+    return pthread_mutex_lock(&semaphore->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore){
+    return pthread_mutex_unlock(&semaphore->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore){
+    pthread_mutex_destroy(&semaphore->mutex);
+    free(semaphore);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void){
+    return create_mutex(PTHREAD_MUTEX_RECURSIVE);
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait){
+    return xSemaphoreTake(semaphore, ticks_to_wait);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore){
+    return xSemaphoreGive(semaphore);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file sdkconfig.h
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host build configuration. Mirrors Kconfig defaults of host built components.
+ *
+ * Storage backend of PCAP serializer can be switched by defining CONFIG_PCAP_SERIALIZER_STORAGE_FLASH,
+ * its file format by defining CONFIG_PCAP_SERIALIZER_FORMAT_PCAP.
+ * Hot path log levels can be overridden the same way to measure cost of debug logging.
+ */
+#ifndef HOST_SHIM_SDKCONFIG_H
+#define HOST_SHIM_SDKCONFIG_H
+
+#ifdef CONFIG_PCAP_SERIALIZER_STORAGE_FLASH
+#define CONFIG_PCAP_SERIALIZER_PARTITION_LABEL "capture"
+#else
+#define CONFIG_PCAP_SERIALIZER_STORAGE_RAM 1
+#define CONFIG_PCAP_SERIALIZER_CHUNK_SIZE 4096
+#define CONFIG_PCAP_SERIALIZER_MAX_SIZE 16777216
+#endif
+
+#ifndef CONFIG_PCAP_SERIALIZER_FORMAT_PCAP
+#define CONFIG_PCAP_SERIALIZER_FORMAT_PCAPNG 1
+#endif
+
+#define CONFIG_ALLOC_POLICY_INTERNAL 1
+#define CONFIG_METRICS_LATENCY_HISTOGRAMS 1
+#define CONFIG_HCCAPX_SERIALIZER_MAX_SESSIONS 8
+#define CONFIG_HC22000_SERIALIZER_MAX_PMKIDS 8
+#define CONFIG_SCAN_MAX_AP 20
+#define CONFIG_SNIFFER_RING_SLOTS 16
+#define CONFIG_SNIFFER_MAX_FRAME_SIZE 1600
+#define CONFIG_SNIFFER_MAX_SUBSCRIBERS 4
+#define CONFIG_SNIFFER_BATCH_SIZE 8
+
+#ifndef CONFIG_FRAME_ANALYZER_LOG_LEVEL
+#define CONFIG_FRAME_ANALYZER_LOG_LEVEL 3
+#endif
+#ifndef CONFIG_HCCAPX_SERIALIZER_LOG_LEVEL
+#define CONFIG_HCCAPX_SERIALIZER_LOG_LEVEL 3
+#endif
+#ifndef CONFIG_SNIFFER_LOG_LEVEL
+#define CONFIG_SNIFFER_LOG_LEVEL 3
+#endif
+#ifndef CONFIG_PCAP_SERIALIZER_LOG_LEVEL
+#define CONFIG_PCAP_SERIALIZER_LOG_LEVEL 3
+#endif
+
+#endif
@@ -0,0 +1,809 @@
+/**
+ * @file test_main.c
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2021
+ *
+ * @brief Host test runner for sniffer filter, frame analyzer parser, serializers, JSON writer, log ring
+ * and replay of reference capture through the whole capture pipeline.
+ *
+ * Usage: host_tests wpa2-psk-handshake.pcap
+ *
+ * Reference capture is generated by data/generate_captures.py.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "frame_analyzer_parser.h"
+#include "pcap_serializer.h"
+#include "hccapx_serializer.h"
+#include "hc22000_serializer.h"
+#include "sniffer_filter.h"
+#include "metrics.h"
+#include "capture_clock.h"
+#include "json_writer.h"
+#include "log_ring.h"
+#include "frame_analyzer.h"
+#include "capture_replay.h"
+
+#include "pcap_reader.h"
+#include "host_sniffer.h"
+#if CONFIG_PCAP_SERIALIZER_STORAGE_FLASH
+#include "esp_partition.h"
+#endif
+
+#define TEST_ASSERT(condition) do {                                                     \
+        if(!(condition)){                                                               \
+            fprintf(stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #condition); \
+            test_failed = 1;                                                            \
+            return;                                                                     \
+        }                                                                               \
+    } while(0)
+
+/**
+ * @brief Indexes of frames in reference capture
+ * @{
+ */
+#define FRAME_OTHER_BSSID_DATA 2
+#define FRAME_STA1_M1 3
+#define FRAME_STA1_M2 4
+#define FRAME_PROTECTED 5
+#define FRAME_QOS_IPV4 6
+#define FRAME_STA2_M1 8
+#define FRAME_STA2_M2 9
+#define FRAME_STA1_M3 10
+#define FRAME_STA1_M4 11
+#define FRAME_STA2_M3 12
+//@}
+
+static const uint8_t ap_mac[6] = { 0x02, 0x11, 0x22, 0x33, 0x44, 0xaa };
+static const uint8_t sta1_mac[6] = { 0x02, 0xaa, 0xbb, 0xcc, 0xdd, 0x01 };
+static const uint8_t sta1_pmkid[16] = {
+    0x76, 0x16, 0x5e, 0x41, 0x71, 0x1e, 0x10, 0xfc, 0xf5, 0x9e, 0xde, 0xff, 0xf0, 0x99, 0x56, 0x94
+};
+
+static const char *capture_path;
+static pcap_reader_capture_t capture;
+static int test_failed;
+
+static data_frame_t *frame_at(unsigned index){
+    return (data_frame_t *) capture.frames[index].data;
+}
+
+static unsigned length_at(unsigned index){
+    return capture.frames[index].length;
+}
+
+static bool parse_key_at(unsigned index, eapol_key_view_t *view){
+    return parse_eapol_key_frame(frame_at(index), length_at(index), view);
+}
+
+static void test_bssid_matching(){
+    uint8_t bssid[6];
+    memcpy(bssid, ap_mac, 6);
+    unsigned length = capture.frames[FRAME_STA1_M1].length;
+    wifi_promiscuous_pkt_t *frame = malloc(sizeof(wifi_promiscuous_pkt_t) + length);
+    memcpy(frame->payload, capture.frames[FRAME_STA1_M1].data, length);
+    TEST_ASSERT(is_frame_bssid_matching(frame, bssid));
+    memcpy(frame->payload, capture.frames[FRAME_OTHER_BSSID_DATA].data, capture.frames[FRAME_OTHER_BSSID_DATA].length);
+    TEST_ASSERT(!is_frame_bssid_matching(frame, bssid));
+    free(frame);
+}
+
+static void test_sniffer_filter(){
+    sniffer_match_t match = {
+        .flags = SNIFFER_MATCH_TYPE | SNIFFER_MATCH_BSSID | SNIFFER_MATCH_ETHERTYPE,
+        .type = WIFI_PKT_DATA,
+        .ethertype = 0x888e
+    };
+    memcpy(match.bssid, ap_mac, 6);
+    sniffer_filter_t filter;
+    sniffer_filter_compile(&filter, &match);
+    unsigned expected_hits = 0;
+    for(unsigned i = 0; i < capture.count; i++){
+        unsigned length = capture.frames[i].length;
+        wifi_promiscuous_pkt_t *frame = malloc(sizeof(wifi_promiscuous_pkt_t) + length);
+        frame->rx_ctrl.sig_len = length;
+        memcpy(frame->payload, capture.frames[i].data, length);
+        // filter has to agree with full parser on which frames are EAPOL of target AP
+        bool expected = (capture.frames[i].data[0] & 0x0c) == 0x08
+            && is_frame_bssid_matching(frame, match.bssid)
+            && parse_eapol_packet((data_frame_t *) frame->payload, length, &(unsigned){ 0 }) != NULL;
+        expected_hits += expected;
+        bool matched = sniffer_filter_match(&filter, frame, (capture.frames[i].data[0] & 0x0c) == 0x08 ? WIFI_PKT_DATA : WIFI_PKT_MGMT);
+        free(frame);
+        TEST_ASSERT(matched == expected);
+    }
+    TEST_ASSERT(expected_hits == 8);
+    TEST_ASSERT(atomic_load(&filter.hits) == expected_hits);
+    TEST_ASSERT(atomic_load(&filter.misses) == capture.count - expected_hits);
+}
+
+/**
+ * @brief Filter has to find ethertype after addr4 and HT control, as parser does
+ */
+static void test_sniffer_filter_header_variants(){
+    sniffer_match_t match = {
+        .flags = SNIFFER_MATCH_TYPE | SNIFFER_MATCH_BSSID | SNIFFER_MATCH_ETHERTYPE,
+        .type = WIFI_PKT_DATA,
+        .ethertype = 0x888e
+    };
+    memcpy(match.bssid, ap_mac, 6);
+    sniffer_filter_t filter;
+    sniffer_filter_compile(&filter, &match);
+    // frame control byte 0, byte 1 flags, bytes inserted after 24 B header
+    const struct { uint8_t fc0; uint8_t fc1; unsigned extra; } variants[] = {
+        { 0x08, 0x03, 6 },      // 4-address
+        { 0x88, 0x80, 6 },      // QoS with HT control
+        { 0x88, 0x83, 12 },     // 4-address QoS with HT control
+    };
+    const uint8_t *original = capture.frames[FRAME_STA1_M1].data;
+    unsigned original_length = length_at(FRAME_STA1_M1);
+    TEST_ASSERT(original[0] == 0x08);
+    for(unsigned i = 0; i < sizeof(variants) / sizeof(variants[0]); i++){
+        unsigned length = original_length + variants[i].extra;
+        wifi_promiscuous_pkt_t *frame = calloc(1, sizeof(wifi_promiscuous_pkt_t) + length);
+        frame->rx_ctrl.sig_len = length;
+        memcpy(frame->payload, original, 24);
+        memcpy(&frame->payload[24 + variants[i].extra], &original[24], original_length - 24);
+        frame->payload[0] = variants[i].fc0;
+        frame->payload[1] = (frame->payload[1] & ~0x03) | variants[i].fc1;
+        TEST_ASSERT(parse_eapol_packet((data_frame_t *) frame->payload, length, &(unsigned){ 0 }) != NULL);
+        TEST_ASSERT(sniffer_filter_match(&filter, frame, WIFI_PKT_DATA));
+        // without the flags ethertype is looked up at wrong offset
+        frame->payload[1] &= ~0x83;
+        frame->payload[0] = 0x08;
+        TEST_ASSERT(!sniffer_filter_match(&filter, frame, WIFI_PKT_DATA));
+        free(frame);
+    }
+}
+
+static void test_parse_eapol_packet(){
+    unsigned eapol_length;
+    TEST_ASSERT(parse_eapol_packet(frame_at(FRAME_STA1_M1), length_at(FRAME_STA1_M1), &eapol_length) != NULL);
+    TEST_ASSERT(parse_eapol_packet(frame_at(FRAME_STA2_M1), length_at(FRAME_STA2_M1), &eapol_length) != NULL);
+    TEST_ASSERT(parse_eapol_packet(frame_at(FRAME_OTHER_BSSID_DATA), length_at(FRAME_OTHER_BSSID_DATA), &eapol_length) == NULL);
+    TEST_ASSERT(parse_eapol_packet(frame_at(FRAME_PROTECTED), length_at(FRAME_PROTECTED), &eapol_length) == NULL);
+    TEST_ASSERT(parse_eapol_packet(frame_at(FRAME_QOS_IPV4), length_at(FRAME_QOS_IPV4), &eapol_length) == NULL);
+    eapol_key_view_t eapol_key;
+    TEST_ASSERT(parse_key_at(FRAME_STA1_M2, &eapol_key));
+    TEST_ASSERT(eapol_key.key_data_length == ntohs(eapol_key.eapol_key->key_data_length));
+    TEST_ASSERT(eapol_key.eapol_key->key_information.key_mic == 1);
+    TEST_ASSERT(eapol_key.eapol_key->key_information.key_ack == 0);
+    TEST_ASSERT(eapol_key.eapol_key->key_information.key_descriptor_version == 2);
+
+    // every truncated copy of M1 is rejected, nothing is read past the given length
+    unsigned length = length_at(FRAME_STA1_M1);
+    for(unsigned i = 0; i < length; i++){
+        uint8_t *copy = malloc(i > 0 ? i : 1);
+        memcpy(copy, frame_at(FRAME_STA1_M1), i);
+        bool parsed = parse_eapol_key_frame((data_frame_t *) copy, i, &eapol_key);
+        free(copy);
+        TEST_ASSERT(!parsed);
+    }
+}
+
+static void test_parse_pmkid(){
+    eapol_key_view_t eapol_key;
+    TEST_ASSERT(parse_key_at(FRAME_STA1_M1, &eapol_key));
+    TEST_ASSERT(eapol_key.eapol_key->key_information.key_ack == 1);
+    pmkid_result_t pmkid_result;
+    TEST_ASSERT(parse_pmkid(&eapol_key, &pmkid_result));
+    TEST_ASSERT(pmkid_result.count == 1);
+    TEST_ASSERT(memcmp(pmkid_result.pmkid[0], sta1_pmkid, 16) == 0);
+
+    // M2 carries RSN IE in key data, not PMKID
+    TEST_ASSERT(parse_key_at(FRAME_STA1_M2, &eapol_key));
+    TEST_ASSERT(!parse_pmkid(&eapol_key, &pmkid_result));
+    TEST_ASSERT(pmkid_result.count == 0);
+    // M1 without key data
+    TEST_ASSERT(parse_key_at(FRAME_STA2_M1, &eapol_key));
+    TEST_ASSERT(!parse_pmkid(&eapol_key, &pmkid_result));
+    // M3 has encrypted key data
+    TEST_ASSERT(parse_key_at(FRAME_STA1_M3, &eapol_key));
+    TEST_ASSERT(eapol_key.eapol_key->key_information.encrypted_key_data == 1);
+    TEST_ASSERT(!parse_pmkid(&eapol_key, &pmkid_result));
+
+    // malformed key data of M1: element of other type with zero length, PMKID KDE overflowing key data
+    TEST_ASSERT(parse_key_at(FRAME_STA1_M1, &eapol_key));
+    static const uint8_t malformed[] = {
+        0xdd, 0x00,
+        0xdd, 0x14, 0x00, 0x0f, 0xac, 0x04, 0x76, 0x16, 0x5e, 0x41
+    };
+    eapol_key.key_data = malformed;
+    eapol_key.key_data_length = sizeof(malformed);
+    TEST_ASSERT(!parse_pmkid(&eapol_key, &pmkid_result));
+    // the same PMKID KDE is found when it's complete and preceded by other elements
+    uint8_t key_data[2 + 2 + 4 + 16 + 2];
+    memcpy(key_data, (const uint8_t[]){ 0x30, 0x00, 0xdd, 0x14, 0x00, 0x0f, 0xac, 0x04 }, 8);
+    memcpy(&key_data[8], sta1_pmkid, 16);
+    memcpy(&key_data[24], (const uint8_t[]){ 0xdd, 0x00 }, 2);
+    eapol_key.key_data = key_data;
+    eapol_key.key_data_length = sizeof(key_data);
+    TEST_ASSERT(parse_pmkid(&eapol_key, &pmkid_result));
+    TEST_ASSERT(pmkid_result.count == 1);
+    TEST_ASSERT(memcmp(pmkid_result.pmkid[0], sta1_pmkid, 16) == 0);
+
+    // PMKIDs above capacity are ignored
+    uint8_t many[(PMKID_RESULT_MAX_COUNT + 2) * 22];
+    for(unsigned i = 0; i < PMKID_RESULT_MAX_COUNT + 2; i++){
+        memcpy(&many[i * 22], (const uint8_t[]){ 0xdd, 0x14, 0x00, 0x0f, 0xac, 0x04 }, 6);
+        memset(&many[i * 22 + 6], i, 16);
+    }
+    eapol_key.key_data = many;
+    eapol_key.key_data_length = sizeof(many);
+    TEST_ASSERT(parse_pmkid(&eapol_key, &pmkid_result));
+    TEST_ASSERT(pmkid_result.count == PMKID_RESULT_MAX_COUNT);
+    TEST_ASSERT(pmkid_result.pmkid[PMKID_RESULT_MAX_COUNT - 1][0] == PMKID_RESULT_MAX_COUNT - 1);
+}
+
+static void test_capture_clock(){
+    capture_clock_reset();
+    // radio timestamp wraps between frames
+    uint64_t first = capture_clock_get_timestamp(0xfffffff0);
+    uint64_t second = capture_clock_get_timestamp(0x00000010);
+    TEST_ASSERT(second >= first);
+    TEST_ASSERT(second - first < 1000000);
+    // frame received before the previous one but processed later is older
+    uint64_t older = capture_clock_get_timestamp(0x00000008);
+    TEST_ASSERT(older < second);
+
+    // 2026-01-01 00:00:00 UTC
+    const uint64_t unix_usec = 1767225600000000ull;
+    capture_clock_set_realtime(unix_usec);
+    TEST_ASSERT(capture_clock_is_realtime());
+    uint64_t anchored = capture_clock_get_timestamp(0x00000020);
+    TEST_ASSERT(anchored >= unix_usec);
+    TEST_ASSERT(anchored - unix_usec < 1000000);
+}
+
+/**
+ * @brief Returns size of record with given frame stored by PCAP serializer
+ *
+ * @param radiotap_length length of radiotap header of PCAPNG record
+ * @param length length of frame
+ * @return unsigned
+ */
+static unsigned pcap_record_size(unsigned radiotap_length, unsigned length){
+#if CONFIG_PCAP_SERIALIZER_FORMAT_PCAPNG
+    // Enhanced Packet Block header, padded radiotap header with frame and trailing length
+    return 28 + ((radiotap_length + length + 3) & ~3u) + 4;
+#else
+    return sizeof(pcap_record_header_t) + length;
+#endif
+}
+
+/**
+ * @brief Checks that record contains given frame and returns pointer to the next record
+ *
+ * @param record
+ * @param frame
+ * @param radiotap_length expected length of radiotap header of PCAPNG record
+ * @return const uint8_t* next record, \c NULL if check failed
+ */
+static const uint8_t *check_pcap_record(const uint8_t *record, const pcap_reader_frame_t *frame, unsigned radiotap_length){
+#if CONFIG_PCAP_SERIALIZER_FORMAT_PCAPNG
+    const uint32_t *epb = (const uint32_t *) record;
+    const uint8_t *radiotap = &record[28];
+    if((epb[0] != 6) || (epb[5] != radiotap_length + frame->length) || (epb[6] != epb[5])
+        || (*(const uint16_t *) &radiotap[2] != radiotap_length)
+        || (memcmp(&radiotap[radiotap_length], frame->data, frame->length) != 0)
+        || (*(const uint32_t *) &record[epb[1] - 4] != epb[1])){
+        return NULL;
+    }
+    return &record[epb[1]];
+#else
+    const pcap_record_header_t *header = (const pcap_record_header_t *) record;
+    if((header->incl_len != frame->length) || (memcmp(&header[1], frame->data, frame->length) != 0)){
+        return NULL;
+    }
+    return &record[sizeof(pcap_record_header_t) + header->incl_len];
+#endif
+}
+
+static void test_pcap_serializer(){
+    // OFDM 6 Mbps frame on channel 6
+    const wifi_pkt_rx_ctrl_t rx_ctrl = { .rssi = -40, .rate = 0xb, .noise_floor = -95, .channel = 6 };
+    // HT MCS 7 frame with short guard interval
+    const wifi_pkt_rx_ctrl_t rx_ctrl_ht = { .rssi = -60, .sig_mode = 1, .mcs = 7, .sgi = 1, .noise_floor = -95, .channel = 11 };
+    const pcap_reader_frame_t *last_frame = &capture.frames[capture.count - 1];
+
+    TEST_ASSERT(pcap_serializer_init("host test") == ESP_OK);
+    const unsigned generation = pcap_serializer_get_generation();
+    unsigned frames_before = metrics_counter_get(METRICS_PCAP_FRAMES);
+    const unsigned header_size = pcap_serializer_get_size();
+    unsigned expected_size = header_size;
+    // Append capture multiple times, so it spans over several storage chunks/pages
+    // Every other pass appends whole capture as one batch, which is longer than single storage write
+    pcap_serializer_frame_t *batch = malloc(capture.count * sizeof(pcap_serializer_frame_t));
+    for(unsigned n = 0; n < 10; n++){
+        for(unsigned i = 0; i < capture.count; i++){
+            if(n % 2 == 0){
+                pcap_serializer_append_frame(capture.frames[i].data, capture.frames[i].length, capture.frames[i].ts_usec, &rx_ctrl);
+            }
+            else {
+                batch[i] = (pcap_serializer_frame_t) { capture.frames[i].data, capture.frames[i].length, capture.frames[i].ts_usec, &rx_ctrl };
+            }
+            expected_size += pcap_record_size(25, capture.frames[i].length);
+        }
+        if(n % 2 == 1){
+            pcap_serializer_append_frames(batch, capture.count);
+        }
+    }
+    free(batch);
+    pcap_serializer_append_frame(last_frame->data, last_frame->length, last_frame->ts_usec, &rx_ctrl_ht);
+    expected_size += pcap_record_size(28, last_frame->length);
+    pcap_serializer_append_frame(last_frame->data, last_frame->length, last_frame->ts_usec, NULL);
+    expected_size += pcap_record_size(8, last_frame->length);
+    TEST_ASSERT(pcap_serializer_get_size() == expected_size);
+    TEST_ASSERT(pcap_serializer_get_dropped_count() == 0);
+    TEST_ASSERT(metrics_counter_get(METRICS_PCAP_FRAMES) - frames_before == 10 * capture.count + 2);
+
+    uint8_t *buffer = malloc(expected_size + 1000);
+    unsigned offset = 0;
+    unsigned length;
+    // odd read size, so reads cross chunk boundaries
+    while((length = pcap_serializer_read(offset, &buffer[offset], 1000)) > 0){
+        offset += length;
+        TEST_ASSERT((length == 1000) || (offset == expected_size));
+    }
+    TEST_ASSERT(offset == expected_size);
+
+#if CONFIG_PCAP_SERIALIZER_FORMAT_PCAPNG
+    // Section Header Block with comment followed by Interface Description Block with radiotap link type
+    const uint32_t *shb = (const uint32_t *) buffer;
+    TEST_ASSERT(shb[0] == 0x0a0d0d0a && shb[2] == 0x1a2b3c4d);
+    TEST_ASSERT(shb[6] == ((9 << 16) | 1) && memcmp(&shb[7], "host test", 9) == 0);
+    const uint32_t *idb = (const uint32_t *) &buffer[shb[1]];
+    TEST_ASSERT(idb[0] == 1 && (idb[2] & 0xffff) == 127);
+    TEST_ASSERT(shb[1] + idb[1] == header_size);
+#else
+    TEST_ASSERT(((const pcap_global_header_t *) buffer)->magic_number == 0xa1b2c3d4);
+    TEST_ASSERT(header_size == sizeof(pcap_global_header_t));
+#endif
+    const uint8_t *record = &buffer[header_size];
+    for(unsigned n = 0; n < 10; n++){
+        for(unsigned i = 0; i < capture.count; i++){
+#if CONFIG_PCAP_SERIALIZER_FORMAT_PCAPNG
+            // channel 2437 MHz, rate 6 Mbps, signal -40 dBm
+            const uint8_t *radiotap = &record[28];
+            TEST_ASSERT(*(const uint16_t *) &radiotap[18] == 2437 && radiotap[17] == 12 && (int8_t) radiotap[22] == -40);
+#endif
+            record = check_pcap_record(record, &capture.frames[i], 25);
+            TEST_ASSERT(record != NULL);
+        }
+    }
+#if CONFIG_PCAP_SERIALIZER_FORMAT_PCAPNG
+    // MCS field is present in HT frame
+    const uint8_t *radiotap = &record[28];
+    TEST_ASSERT((*(const uint32_t *) &radiotap[4] & (1 << 19)) && radiotap[27] == 7 && radiotap[26] == 0x04);
+#endif
+    record = check_pcap_record(record, last_frame, 28);
+    TEST_ASSERT(record != NULL);
+    record = check_pcap_record(record, last_frame, 8);
+    TEST_ASSERT(record == &buffer[expected_size]);
+    free(buffer);
+    // appending doesn't change generation, reset does
+    TEST_ASSERT(pcap_serializer_get_generation() == generation);
+    pcap_serializer_deinit();
+    TEST_ASSERT(pcap_serializer_get_generation() != generation);
+    TEST_ASSERT(pcap_serializer_get_size() == 0);
+    TEST_ASSERT(pcap_serializer_read(0, (uint8_t[1]){ 0 }, 1) == 0);
+}
+
+static void test_hccapx_serializer(){
+    const char *ssid = "TestNetwork";
+    hccapx_serializer_init((const uint8_t *) ssid, strlen(ssid));
+    TEST_ASSERT(hccapx_serializer_get_count() == 0);
+    hccapx_t records[2];
+    TEST_ASSERT(!hccapx_serializer_get(0, &records[0]));
+    const unsigned frames[] = { FRAME_STA1_M1, FRAME_STA1_M2, FRAME_STA2_M1, FRAME_STA2_M2, FRAME_STA1_M3, FRAME_STA1_M4 };
+    for(unsigned i = 0; i < sizeof(frames) / sizeof(frames[0]); i++){
+        hccapx_serializer_add_frame(frame_at(frames[i]), length_at(frames[i]));
+    }
+    // both clients have complete handshake
+    TEST_ASSERT(hccapx_serializer_get_count() == 2);
+    const hccapx_t *hccapx = NULL;
+    const hccapx_t *hccapx_sta2 = NULL;
+    for(unsigned i = 0; i < 2; i++){
+        const hccapx_t *record = &records[i];
+        TEST_ASSERT(hccapx_serializer_get(i, &records[i]));
+        if(memcmp(record->mac_sta, sta1_mac, 6) == 0){
+            hccapx = record;
+        }
+        else {
+            hccapx_sta2 = record;
+        }
+    }
+    TEST_ASSERT(hccapx != NULL && hccapx_sta2 != NULL);
+    // STA1: EAPoL from M2, ANonce confirmed by M3
+    TEST_ASSERT(hccapx->message_pair == 2);
+    TEST_ASSERT(hccapx->essid_len == strlen(ssid));
+    TEST_ASSERT(memcmp(hccapx->mac_ap, ap_mac, 6) == 0);
+
+    eapol_key_view_t m2;
+    TEST_ASSERT(parse_key_at(FRAME_STA1_M2, &m2));
+    TEST_ASSERT(hccapx->eapol_len == m2.eapol_length);
+    TEST_ASSERT(memcmp(hccapx->keymic, m2.eapol_key->key_mic, 16) == 0);
+    TEST_ASSERT(memcmp(hccapx->nonce_sta, m2.eapol_key->key_nonce, 32) == 0);
+    eapol_key_view_t m1;
+    TEST_ASSERT(parse_key_at(FRAME_STA1_M1, &m1));
+    TEST_ASSERT(memcmp(hccapx->nonce_ap, m1.eapol_key->key_nonce, 32) == 0);
+
+    // STA2: only M1 and M2 so far
+    TEST_ASSERT(hccapx_sta2->message_pair == 0);
+    eapol_key_view_t sta2_m2;
+    TEST_ASSERT(parse_key_at(FRAME_STA2_M2, &sta2_m2));
+    TEST_ASSERT(memcmp(hccapx_sta2->nonce_sta, sta2_m2.eapol_key->key_nonce, 32) == 0);
+
+    // STA2 M3 upgrades its record to authorized handshake, still one record per client
+    hccapx_serializer_add_frame(frame_at(FRAME_STA2_M3), length_at(FRAME_STA2_M3));
+    TEST_ASSERT(hccapx_serializer_get_count() == 2);
+    // records are copies, fetch STA2 record again
+    unsigned sta2_index = hccapx_sta2 - records;
+    TEST_ASSERT(hccapx_serializer_get(sta2_index, &records[sta2_index]));
+    TEST_ASSERT(hccapx_sta2->message_pair == 2);
+
+    // non EAPoL-Key frame is rejected
+    hccapx_serializer_add_frame(frame_at(FRAME_QOS_IPV4), length_at(FRAME_QOS_IPV4));
+    TEST_ASSERT(hccapx_serializer_get_count() == 2);
+}
+
+static void test_hc22000_serializer(){
+    const char *ssid = "TestNetwork";
+    char line[HC22000_SERIALIZER_MAX_LINE_SIZE];
+    hccapx_serializer_init((const uint8_t *) ssid, strlen(ssid));
+    hc22000_serializer_init((const uint8_t *) ssid, strlen(ssid));
+    TEST_ASSERT(hc22000_serializer_get_count() == 0);
+    TEST_ASSERT(hc22000_serializer_get_line(0, line, sizeof(line)) == 0);
+    const unsigned frames[] = { FRAME_STA1_M1, FRAME_STA1_M2, FRAME_STA1_M3, FRAME_STA1_M4 };
+    for(unsigned i = 0; i < sizeof(frames) / sizeof(frames[0]); i++){
+        hccapx_serializer_add_frame(frame_at(frames[i]), length_at(frames[i]));
+        hc22000_serializer_add_frame(frame_at(frames[i]), length_at(frames[i]));
+    }
+    // PMKID from M1 is stored once even if it's added again
+    hc22000_serializer_add_pmkid(ap_mac, sta1_mac, sta1_pmkid);
+    TEST_ASSERT(hc22000_serializer_get_count() == 2);
+    TEST_ASSERT(hc22000_serializer_get_line(0, line, sizeof(line) - 1) == 0);
+
+    const char *pmkid_line = "WPA*01*76165e41711e10fcf59edefff0995694*0211223344aa*02aabbccdd01*546573744e6574776f726b***\n";
+    TEST_ASSERT(hc22000_serializer_get_line(0, line, sizeof(line)) == strlen(pmkid_line));
+    TEST_ASSERT(strcmp(line, pmkid_line) == 0);
+
+    hccapx_t hccapx;
+    TEST_ASSERT(hccapx_serializer_get(0, &hccapx));
+    unsigned length = hc22000_serializer_get_line(1, line, sizeof(line));
+    TEST_ASSERT(length == strlen(line));
+    // prefix, 6 hex fields with separators, EAPoL, message pair and new line
+    TEST_ASSERT(length == 7 + 33 + 13 + 13 + 23 + 65 + (hccapx.eapol_len * 2 + 1) + 2 + 1);
+    TEST_ASSERT(strncmp(line, "WPA*02*", 7) == 0);
+    TEST_ASSERT(strncmp(&line[39], "*0211223344aa*02aabbccdd01*546573744e6574776f726b*", 50) == 0);
+    TEST_ASSERT(strcmp(&line[length - 4], "*02\n") == 0);
+    // MIC is zeroed inside EAPoL
+    TEST_ASSERT(strncmp(&line[7 + 33 + 13 + 13 + 23 + 65 + 81 * 2], "00000000000000000000000000000000", 32) == 0);
+    TEST_ASSERT(hc22000_serializer_get_line(2, line, sizeof(line)) == 0);
+}
+
+/**
+ * @brief Collects rendered metrics into one string
+ */
+typedef struct {
+    char text[32768];
+    unsigned length;
+} metrics_buffer_t;
+
+static esp_err_t metrics_buffer_write(void *ctx, const char *data, unsigned length){
+    metrics_buffer_t *buffer = (metrics_buffer_t *) ctx;
+    if(buffer->length + length >= sizeof(buffer->text)){
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(&buffer->text[buffer->length], data, length);
+    buffer->length += length;
+    buffer->text[buffer->length] = '\0';
+    return ESP_OK;
+}
+
+static unsigned gauge_value(){
+    return 42;
+}
+
+static void test_metrics(){
+    static metrics_buffer_t buffer;
+    buffer.length = 0;
+    metrics_counter_add(METRICS_HCCAPX_REJECTED, 3);
+    TEST_ASSERT(metrics_register_gauge("test_gauge", "Test gauge", &gauge_value) == ESP_OK);
+    metrics_histogram_observe(METRICS_HISTOGRAM_EAPOLKEY_FRAME_HANDLER, metrics_histogram_start());
+    TEST_ASSERT(metrics_render(&metrics_buffer_write, &buffer) == ESP_OK);
+    char expected[128];
+    snprintf(expected, sizeof(expected), "# TYPE wpt_hccapx_rejected_total counter\nwpt_hccapx_rejected_total %u\n", metrics_counter_get(METRICS_HCCAPX_REJECTED));
+    TEST_ASSERT(strstr(buffer.text, expected) != NULL);
+    TEST_ASSERT(strstr(buffer.text, "# TYPE wpt_test_gauge gauge\nwpt_test_gauge 42\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "# HELP wpt_heap_internal_minimum_free_bytes ") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "# TYPE wpt_eapolkey_frame_handler_duration_seconds histogram\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_eapolkey_frame_handler_duration_seconds_bucket{le=\"+Inf\"} 1\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_eapolkey_frame_handler_duration_seconds_count 1\n") != NULL);
+    // every append of pcap_serializer test is measured, batch as one
+    snprintf(expected, sizeof(expected), "wpt_pcap_append_frame_duration_seconds_count %u\n", 5 * capture.count + 5 + 2);
+    TEST_ASSERT(strstr(buffer.text, expected) != NULL);
+
+    buffer.length = 0;
+    metrics_size_histogram_observe(METRICS_SIZE_HISTOGRAM_SNIFFER_BATCH, 1);
+    metrics_size_histogram_observe(METRICS_SIZE_HISTOGRAM_SNIFFER_BATCH, 5);
+    metrics_size_histogram_observe(METRICS_SIZE_HISTOGRAM_SNIFFER_BATCH, 8);
+    metrics_size_histogram_observe(METRICS_SIZE_HISTOGRAM_SNIFFER_BATCH, 1000);
+    TEST_ASSERT(metrics_render(&metrics_buffer_write, &buffer) == ESP_OK);
+    TEST_ASSERT(strstr(buffer.text, "# TYPE wpt_sniffer_batch_frames histogram\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_sniffer_batch_frames_bucket{le=\"1\"} 1\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_sniffer_batch_frames_bucket{le=\"4\"} 1\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_sniffer_batch_frames_bucket{le=\"8\"} 3\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_sniffer_batch_frames_bucket{le=\"256\"} 3\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_sniffer_batch_frames_bucket{le=\"+Inf\"} 4\n") != NULL);
+    TEST_ASSERT(strstr(buffer.text, "wpt_sniffer_batch_frames_sum 1014\nwpt_sniffer_batch_frames_count 4\n") != NULL);
+}
+
+static void test_json_writer(){
+    static metrics_buffer_t buffer;
+    buffer.length = 0;
+    // tiny buffer, so document is flushed in many parts
+    char chunk[7];
+    json_writer_t writer;
+    json_writer_init(&writer, chunk, sizeof(chunk), &metrics_buffer_write, &buffer);
+    json_writer_begin_array(&writer);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "ssid");
+    json_writer_string(&writer, "a\"b\\c\n\x01");
+    json_writer_key(&writer, "rssi");
+    json_writer_int(&writer, -71);
+    json_writer_key(&writer, "hidden");
+    json_writer_bool(&writer, false);
+    json_writer_key(&writer, "empty");
+    json_writer_begin_array(&writer);
+    json_writer_end_array(&writer);
+    json_writer_end_object(&writer);
+    json_writer_uint(&writer, 4294967296ULL);
+    json_writer_bool(&writer, true);
+    json_writer_end_array(&writer);
+    TEST_ASSERT(json_writer_finish(&writer) == ESP_OK);
+    TEST_ASSERT(strcmp(buffer.text, "[{\"ssid\":\"a\\\"b\\\\c\\u000a\\u0001\",\"rssi\":-71,\"hidden\":false,\"empty\":[]},4294967296,true]") == 0);
+
+    // without flush callback the whole document has to fit into the buffer
+    json_writer_init(&writer, chunk, sizeof(chunk), NULL, NULL);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "a");
+    json_writer_uint(&writer, 1);
+    json_writer_end_object(&writer);
+    TEST_ASSERT(json_writer_finish(&writer) == ESP_OK);
+    TEST_ASSERT(json_writer_get_length(&writer) == 7);
+    TEST_ASSERT(memcmp(chunk, "{\"a\":1}", 7) == 0);
+    json_writer_init(&writer, chunk, sizeof(chunk), NULL, NULL);
+    json_writer_string(&writer, "too long");
+    TEST_ASSERT(json_writer_finish(&writer) == ESP_ERR_NO_MEM);
+
+    // unbalanced nesting and flush errors are reported
+    json_writer_init(&writer, chunk, sizeof(chunk), NULL, NULL);
+    json_writer_begin_array(&writer);
+    TEST_ASSERT(json_writer_finish(&writer) == ESP_ERR_INVALID_STATE);
+    buffer.length = sizeof(buffer.text);
+    json_writer_init(&writer, chunk, sizeof(chunk), &metrics_buffer_write, &buffer);
+    json_writer_string(&writer, "flushed");
+    TEST_ASSERT(json_writer_finish(&writer) == ESP_ERR_NO_MEM);
+}
+
+static void test_log_ring(){
+    char buffer[8];
+    char data[16];
+    log_ring_t ring;
+    log_ring_init(&ring, buffer, sizeof(buffer));
+    uint64_t position = 0;
+    uint64_t skipped;
+    TEST_ASSERT(log_ring_read(&ring, &position, data, sizeof(data), &skipped) == 0);
+    TEST_ASSERT(skipped == 0);
+
+    log_ring_write(&ring, "abcde", 5);
+    TEST_ASSERT(log_ring_read(&ring, &position, data, 3, &skipped) == 3);
+    TEST_ASSERT(memcmp(data, "abc", 3) == 0);
+    // write wraps around the end of buffer, reader is still within the ring
+    log_ring_write(&ring, "fghij", 5);
+    TEST_ASSERT(log_ring_tail(&ring) == 2);
+    TEST_ASSERT(log_ring_read(&ring, &position, data, sizeof(data), &skipped) == 7);
+    TEST_ASSERT(skipped == 0);
+    TEST_ASSERT(memcmp(data, "defghij", 7) == 0);
+
+    // slow reader loses overwritten bytes and learns how many
+    log_ring_write(&ring, "klmnopqrst", 10);
+    TEST_ASSERT(log_ring_read(&ring, &position, data, sizeof(data), &skipped) == 8);
+    TEST_ASSERT(skipped == 2);
+    TEST_ASSERT(memcmp(data, "mnopqrst", 8) == 0);
+    TEST_ASSERT(position == 20);
+
+    // new reader starts at the oldest kept byte
+    position = 0;
+    TEST_ASSERT(log_ring_read(&ring, &position, data, sizeof(data), &skipped) == 8);
+    TEST_ASSERT(skipped == 12);
+    TEST_ASSERT(memcmp(data, "mnopqrst", 8) == 0);
+}
+
+/**
+ * @brief Reads replayed capture from file
+ *
+ * @param ctx FILE
+ */
+static esp_err_t file_read(void *ctx, size_t offset, void *data, size_t length){
+    FILE *file = ctx;
+    if((fseek(file, offset, SEEK_SET) != 0) || (fread(data, 1, length, file) != length)){
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static unsigned replayed_eapolkey_frames;
+
+static void replay_eapolkey_handler(const wifi_promiscuous_pkt_t *const *frames, unsigned count){
+    for(unsigned i = 0; i < count; i++){
+        hccapx_serializer_add_frame((const data_frame_t *) frames[i]->payload, frames[i]->rx_ctrl.sig_len);
+    }
+    replayed_eapolkey_frames += count;
+}
+
+static void test_capture_replay(){
+    const char *ssid = "TestNetwork";
+    FILE *file = fopen(capture_path, "rb");
+    TEST_ASSERT(file != NULL);
+    fseek(file, 0, SEEK_END);
+    size_t size = ftell(file);
+    capture_replay_config_t config = { .realtime = false, .channel = 6 };
+    capture_replay_stats_t stats;
+
+    for(unsigned run = 0; run < 2; run++){
+        // the second run keeps recorded gaps between frames
+        config.realtime = (run == 1);
+        hccapx_serializer_init((const uint8_t *) ssid, strlen(ssid));
+        replayed_eapolkey_frames = 0;
+        frame_analyzer_capture_start(SEARCH_HANDSHAKE, ap_mac, &replay_eapolkey_handler);
+        esp_err_t err = capture_replay_run(&file_read, file, size, &config, &stats);
+        host_sniffer_flush();
+        frame_analyzer_capture_stop();
+        TEST_ASSERT(err == ESP_OK);
+        TEST_ASSERT(stats.frames == capture.count && stats.skipped == 0);
+        TEST_ASSERT(stats.capture_usec == capture.frames[capture.count - 1].ts_usec - capture.frames[0].ts_usec);
+        TEST_ASSERT(!config.realtime || stats.elapsed_usec >= stats.capture_usec);
+        TEST_ASSERT(wifictl_sniffer_get_dropped_count() == 0);
+        // M1-M4 of both clients, EAPOL-Key frame of other BSSID is filtered out by sniffer
+        TEST_ASSERT(replayed_eapolkey_frames == 8);
+        TEST_ASSERT(hccapx_serializer_get_count() == 2);
+        hccapx_t records[2];
+        TEST_ASSERT(hccapx_serializer_get(0, &records[0]) && hccapx_serializer_get(1, &records[1]));
+        TEST_ASSERT(records[0].message_pair == 2 && records[1].message_pair == 2);
+    }
+
+    // stop requested before replay starts isn't lost
+    capture_replay_stop();
+    TEST_ASSERT(capture_replay_run(&file_read, file, size, &config, &stats) == ESP_OK);
+    TEST_ASSERT(stats.frames == 0);
+    capture_replay_reset();
+
+    // truncated capture ends replay at the last complete record
+    TEST_ASSERT(capture_replay_run(&file_read, file, size - 1, &config, &stats) == ESP_OK);
+    TEST_ASSERT(stats.frames == capture.count - 1);
+    // only classic PCAP is supported
+    TEST_ASSERT(capture_replay_run(&file_read, file, 8, &config, &stats) == ESP_ERR_NOT_SUPPORTED);
+    fclose(file);
+}
+
+static void count_frame(const wifi_promiscuous_pkt_t *frame, wifi_promiscuous_pkt_type_t type, void *args){
+    (*(unsigned *) args)++;
+}
+
+static void test_sniffer_resubscribe(){
+    const sniffer_match_t match = { .flags = SNIFFER_MATCH_TYPE, .type = WIFI_PKT_DATA };
+    unsigned length = length_at(FRAME_STA1_M1);
+    wifi_promiscuous_pkt_t *frame = calloc(1, sizeof(wifi_promiscuous_pkt_t) + length);
+    frame->rx_ctrl.sig_len = length;
+    memcpy(frame->payload, frame_at(FRAME_STA1_M1), length);
+    unsigned old_frames = 0;
+    unsigned new_frames = 0;
+    sniffer_subscription_t old_subscription, new_subscription;
+
+    TEST_ASSERT(wifictl_sniffer_subscribe(&match, &count_frame, NULL, &old_frames, &old_subscription) == ESP_OK);
+    // frame stays in ring, as batch isn't full
+    wifictl_sniffer_inject(frame, WIFI_PKT_DATA);
+    wifictl_sniffer_unsubscribe(old_subscription);
+    TEST_ASSERT(wifictl_sniffer_subscribe(&match, &count_frame, NULL, &new_frames, &new_subscription) == ESP_OK);
+    TEST_ASSERT(new_subscription == old_subscription);
+    wifictl_sniffer_inject(frame, WIFI_PKT_DATA);
+    host_sniffer_flush();
+    // frame matched for cancelled subscription isn't passed to new one in the same slot
+    TEST_ASSERT(old_frames == 0 && new_frames == 1);
+    wifictl_sniffer_unsubscribe(new_subscription);
+    free(frame);
+}
+
+#if CONFIG_PCAP_SERIALIZER_STORAGE_FLASH
+/**
+ * @brief Batch that fails after some of its pages were flushed is rolled back, so its records are retried one by one
+ * and every record is stored exactly once.
+ */
+static void test_pcap_storage_flash_rollback(){
+    uint8_t data[1500];
+    for(unsigned i = 0; i < sizeof(data); i++){
+        data[i] = i;
+    }
+    pcap_reader_frame_t frame = { .ts_usec = 1000000, .length = sizeof(data), .data = data };
+    pcap_serializer_frame_t batch[8];
+    for(unsigned i = 0; i < 8; i++){
+        batch[i] = (pcap_serializer_frame_t) { frame.data, frame.length, frame.ts_usec, NULL };
+    }
+    TEST_ASSERT(pcap_serializer_init("rollback") == ESP_OK);
+    const unsigned header_size = pcap_serializer_get_size();
+    // page is partially buffered when failing batch starts
+    pcap_serializer_append_frame(frame.data, frame.length, frame.ts_usec, NULL);
+    // batch spans three pages, the first flush succeeds and the second one fails
+    host_partition_fail_write(1);
+    pcap_serializer_append_frames(batch, 8);
+    pcap_serializer_append_frames(batch, 8);
+    const unsigned expected_size = header_size + 17 * pcap_record_size(8, frame.length);
+    TEST_ASSERT(pcap_serializer_get_size() == expected_size);
+    TEST_ASSERT(pcap_serializer_get_dropped_count() == 0);
+
+    uint8_t *buffer = malloc(expected_size);
+    TEST_ASSERT(pcap_serializer_read(0, buffer, expected_size) == expected_size);
+    const uint8_t *record = &buffer[header_size];
+    for(unsigned i = 0; (i < 17) && (record != NULL); i++){
+        record = check_pcap_record(record, &frame, 8);
+    }
+    TEST_ASSERT(record == &buffer[expected_size]);
+    free(buffer);
+    pcap_serializer_deinit();
+}
+#endif
+
+/**
+ * @brief Registered tests
+ */
+static const struct {
+    const char *name;
+    void (*run)();
+} tests[] = {
+    { "bssid_matching", test_bssid_matching },
+    { "sniffer_filter", test_sniffer_filter },
+    { "sniffer_filter_header_variants", test_sniffer_filter_header_variants },
+    { "parse_eapol_packet", test_parse_eapol_packet },
+    { "parse_pmkid", test_parse_pmkid },
+    { "capture_clock", test_capture_clock },
+    { "pcap_serializer", test_pcap_serializer },
+    { "hccapx_serializer", test_hccapx_serializer },
+    { "hc22000_serializer", test_hc22000_serializer },
+    { "metrics", test_metrics },
+    { "json_writer", test_json_writer },
+    { "log_ring", test_log_ring },
+    { "capture_replay", test_capture_replay },
+    { "sniffer_resubscribe", test_sniffer_resubscribe },
+#if CONFIG_PCAP_SERIALIZER_STORAGE_FLASH
+    { "pcap_storage_flash_rollback", test_pcap_storage_flash_rollback },
+#endif
+};
+
+int main(int argc, char *argv[]){
+    if(argc < 2){
+        fprintf(stderr, "Usage: %s wpa2-psk-handshake.pcap\n", argv[0]);
+        return 1;
+    }
+    esp_log_level_set("*", ESP_LOG_WARN);
+    capture_path = argv[1];
+    if(pcap_reader_load(argv[1], &capture) != 0){
+        return 1;
+    }
+    unsigned failed = 0;
+    for(unsigned i = 0; i < sizeof(tests) / sizeof(tests[0]); i++){
+        test_failed = 0;
+        tests[i].run();
+        printf("%-24s %s\n", tests[i].name, test_failed ? "FAIL" : "OK");
+        failed += test_failed;
+    }
+    pcap_reader_free(&capture);
+    printf("%u tests, %u failed\n", (unsigned) (sizeof(tests) / sizeof(tests[0])), failed);
+    return failed ? 1 : 0;
+}
@@ -9,6 +9,7 @@
 
 #include "attack.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -17,7 +18,10 @@
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 
+#include "alloc_policy.h"
 #include "attack_pmkid.h"
 #include "attack_handshake.h"
 #include "attack_dos.h"
@@ -25,29 +29,54 @@
 #include "wifi_controller.h"
 
 static const char* TAG = "attack";
+ESP_EVENT_DEFINE_BASE(ATTACK_EVENTS);
 static attack_status_t attack_status = { .state = READY, .type = -1, .content_size = 0, .content = NULL };
+/**
+ * @brief Protects status content, as it's appended by sniffer task and reset from event loop.
+ */
+static SemaphoreHandle_t status_content_mutex;
 static esp_timer_handle_t attack_timeout_handle;
+/**
+ * @brief Copy of targeted AP record, so background scan can't change it while attack is running.
+ */
+static wifi_ap_record_t target_ap_record;
 
 const attack_status_t *attack_get_status() {
     return &attack_status;
 }
 
+/**
+ * @brief Posts ATTACK_EVENT_STATUS_CHANGED event.
+ * 
+ * It's called also from event loop handlers, so it doesn't wait for free space in event queue.
+ * Subscribers can always read current status by attack_get_status(), so dropped event only delays update.
+ */
+static void notify_status_changed(){
+    esp_err_t err = esp_event_post(ATTACK_EVENTS, ATTACK_EVENT_STATUS_CHANGED, NULL, 0, 0);
+    if(err != ESP_OK){
+        ESP_LOGW(TAG, "Status change not published: %s", esp_err_to_name(err));
+    }
+}
+
 void attack_update_status(attack_state_t state) {
     attack_status.state = state;
     if(state == FINISHED) {
         ESP_LOGD(TAG, "Stopping attack timeout timer");
         ESP_ERROR_CHECK(esp_timer_stop(attack_timeout_handle));
     } 
+    notify_status_changed();
 }
 
-void attack_append_status_content(uint8_t *buffer, unsigned size){
+void attack_append_status_content(const uint8_t *buffer, unsigned size){
     if(size == 0){
         ESP_LOGE(TAG, "Size can't be 0 if you want to reallocate");
         return;
     }
+    xSemaphoreTake(status_content_mutex, portMAX_DELAY);
     // temporarily save new location in case of realloc failure to preserve current content
-    char *reallocated_content = realloc(attack_status.content, attack_status.content_size + size);
+    char *reallocated_content = alloc_policy_realloc(ALLOC_POLICY_SUBSYSTEM_ATTACK_STATUS, attack_status.content, attack_status.content_size + size);
     if(reallocated_content == NULL){
+        xSemaphoreGive(status_content_mutex);
         ESP_LOGE(TAG, "Error reallocating status content! Status content may not be complete.");
         return;
     }
@@ -55,12 +84,16 @@ void attack_append_status_content(uint8_t *buffer, unsigned size){
     memcpy(&reallocated_content[attack_status.content_size], buffer, size);
     attack_status.content = reallocated_content;
     attack_status.content_size += size;
+    xSemaphoreGive(status_content_mutex);
 }
 
 char *attack_alloc_result_content(unsigned size) {
+    xSemaphoreTake(status_content_mutex, portMAX_DELAY);
     attack_status.content_size = size;
-    attack_status.content = (char *) malloc(size);
-    return attack_status.content;
+    attack_status.content = (char *) alloc_policy_malloc(ALLOC_POLICY_SUBSYSTEM_ATTACK_STATUS, size);
+    char *content = attack_status.content;
+    xSemaphoreGive(status_content_mutex);
+    return content;
 }
 
 /**
@@ -95,6 +128,39 @@ static void attack_timeout(void* arg){
         default:
             ESP_LOGE(TAG, "Unknown attack type. Not aborting anything");
     }
+    // radio is back on management AP channel only after attack is stopped
+    wifictl_scan_background_resume();
+}
+
+/**
+ * @brief Finds requested AP in cached scan results.
+ * 
+ * AP is looked up by BSSID, because indexes of cached records change with every background scan.
+ * Index is used only if request doesn't contain valid BSSID. Blocking scan is done only if AP is not cached.
+ * 
+ * @param attack_request 
+ * @return const wifi_ap_record_t* copy of AP record or NULL if AP wasn't found
+ */
+static const wifi_ap_record_t *find_target_ap_record(const attack_request_t *attack_request){
+    uint8_t bssid[6];
+    bool has_bssid = sscanf(attack_request->bssid, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
+        &bssid[0], &bssid[1], &bssid[2], &bssid[3], &bssid[4], &bssid[5]) == 6;
+    if(!has_bssid){
+        return wifictl_get_ap_record(attack_request->ap_record_id, &target_ap_record) ? &target_ap_record : NULL;
+    }
+    if(wifictl_find_ap_record(bssid, &target_ap_record)){
+        return &target_ap_record;
+    }
+    if((attack_request->attack_type == ATTACK_TYPE_HANDSHAKE) && (attack_request->attack_method == ATTACK_HANDSHAKE_METHOD_REPLAY)){
+        // replayed capture could be recorded anywhere, target AP doesn't have to be nearby
+        memset(&target_ap_record, 0, sizeof(target_ap_record));
+        memcpy(target_ap_record.bssid, bssid, 6);
+        strncpy((char *) target_ap_record.ssid, attack_request->ssid, sizeof(target_ap_record.ssid) - 1);
+        return &target_ap_record;
+    }
+    ESP_LOGD(TAG, "AP %s not cached, scanning...", attack_request->bssid);
+    wifictl_scan_nearby_aps();
+    return wifictl_find_ap_record(bssid, &target_ap_record) ? &target_ap_record : NULL;
 }
 
 /**
@@ -113,16 +179,19 @@ static void attack_timeout(void* arg){
  */
 static void attack_request_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
     ESP_LOGI(TAG, "Starting attack...");
-    wifictl_scan_nearby_aps();
-
-    const wifictl_ap_records_t *ap_records;
-    ap_records = wifictl_get_ap_records();
     attack_request_t *attack_request = (attack_request_t *) event_data;
     attack_config_t attack_config = { .type = attack_request->attack_type, .method = attack_request->attack_method, .timeout = attack_request->timeout };
-    attack_config.ap_record = wifictl_get_ap_record(attack_request->ap_record_id);
+    attack_config.ap_record = find_target_ap_record(attack_request);
+    if(attack_config.ap_record == NULL){
+        ESP_LOGE(TAG, "Requested AP %s (record id %d) not found!", attack_request->bssid, attack_request->ap_record_id);
+        return;
+    }
     
+    // background AP scan would take radio off attacked channel
+    wifictl_scan_background_pause();
     attack_status.state = RUNNING;
     attack_status.type = attack_config.type;
+    notify_status_changed();
         // Print attack configuration
     ESP_LOGI(TAG, "Attack configuration:");
     ESP_LOGI(TAG, "record id: %d", attack_request->ap_record_id);
@@ -130,10 +199,6 @@ static void attack_request_handler(void *args, esp_event_base_t event_base, int3
     ESP_LOGI(TAG, "Method: %d", attack_config.method);
     ESP_LOGI(TAG, "Timeout: %d seconds", attack_config.timeout);
 
-    if(attack_config.ap_record == NULL){
-        ESP_LOGE(TAG, "NPE: No attack_config.ap_record!");
-        return;
-    }
     ESP_LOGI(TAG, "AP record found: SSID: %s, BSSID: %02X:%02X:%02X:%02X:%02X:%02X", 
         attack_config.ap_record->ssid, 
         attack_config.ap_record->bssid[0], attack_config.ap_record->bssid[1],
@@ -172,22 +237,26 @@ static void attack_request_handler(void *args, esp_event_base_t event_base, int3
  */
 static void attack_reset_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
     ESP_LOGD(TAG, "Resetting attack status...");
+    xSemaphoreTake(status_content_mutex, portMAX_DELAY);
     if(attack_status.content){
         free(attack_status.content);
         attack_status.content = NULL;
     }
     attack_status.content_size = 0;
+    xSemaphoreGive(status_content_mutex);
     attack_status.type = -1;
     attack_status.state = READY;
+    notify_status_changed();
 }
 
 /**
  * @brief Initialises common attack resources.
  * 
- * Creates attack timeout timer.
+ * Creates attack timeout timer and status content mutex.
  * Registers event loop event handlers.
  */
 void attack_init(){
+    status_content_mutex = xSemaphoreCreateMutex();
     const esp_timer_create_args_t attack_timeout_args = {
         .callback = &attack_timeout
     };
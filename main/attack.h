@@ -14,6 +14,12 @@
 #define ATTACK_H
 
 #include "esp_wifi_types.h"
+#include "esp_event.h"
+
+ESP_EVENT_DECLARE_BASE(ATTACK_EVENTS);
+enum {
+    ATTACK_EVENT_STATUS_CHANGED ///< attack state or type changed, event has no data, current status is available by attack_get_status()
+};
 
 /**
  * @brief Implemented attack types that can be chosen.
@@ -73,6 +79,7 @@ const attack_status_t *attack_get_status();
  * @brief Function to update current status of attack.
  * 
  * If FINISHED state is passed, then the attack timeout timer is stopped.
+ * ATTACK_EVENT_STATUS_CHANGED is posted to default event loop.
  * @param state new attack state of type attack_state_t to be set
  */
 void attack_update_status(attack_state_t state);
@@ -98,6 +105,6 @@ char *attack_alloc_result_content(unsigned size);
  * @param buffer new data to be appended to status content
  * @param size size of the new data to be appended
  */
-void attack_append_status_content(uint8_t *buffer, unsigned size);
+void attack_append_status_content(const uint8_t *buffer, unsigned size);
 
 #endif
\ No newline at end of file
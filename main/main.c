@@ -10,6 +10,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
@@ -23,6 +24,8 @@
 #include "freertos/task.h"
 #include "lora.h"
 #include "cJSON.h"
+#include "alloc_policy.h"
+#include "log_buffer.h"
 
 
 
@@ -86,6 +89,13 @@ void task_rx(void *p)
     }
 }
 
+/**
+ * @brief cJSON allocator routed through allocation policy, so JSON documents are placed as bulk data.
+ */
+static void *json_malloc(size_t size){
+    return alloc_policy_malloc(ALLOC_POLICY_SUBSYSTEM_JSON, size);
+}
+
 // Declare the HTTP event handler function
 esp_err_t _http_event_handle(esp_http_client_event_t *evt);
 
@@ -94,19 +104,24 @@ esp_err_t _http_event_handle(esp_http_client_event_t *evt);
 void app_main(void)
 {
     ESP_LOGD(TAG, "app_main started");
+    ESP_ERROR_CHECK_WITHOUT_ABORT(log_buffer_init());
     esp_err_t nvs_ret = nvs_flash_init();
     if (nvs_ret != ESP_OK) {
         ESP_LOGE(TAG, "NVS Flash Init Error %d", nvs_ret);
         return;
     }
+    cJSON_Hooks json_hooks = { .malloc_fn = json_malloc, .free_fn = free };
+    cJSON_InitHooks(&json_hooks);
     lora_init();
     lora_set_frequency(915E6);
     lora_enable_crc();
     //xTaskCreate(&task_tx, "task_tx", 2048, NULL, 5, NULL);
     ESP_ERROR_CHECK(esp_event_loop_create_default());
     wifictl_mgmt_ap_start();
+    wifictl_scan_init();
     attack_init();
     webserver_run();
+    alloc_policy_report();
     lora_set_sync_word(0xF3);
     xTaskCreate(&task_rx, "task_rx", 4096, NULL, 5, NULL);
     printf("app_main finished\n");